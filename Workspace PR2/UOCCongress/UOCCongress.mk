@@ -62,7 +62,7 @@ AS       := C:/winbuilds/bin/as.exe
 ## User defined environment variables
 ##
 CodeLiteDir:=C:\Program Files\CodeLite
-Objects0=$(IntermediateDirectory)/test_src_utils.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_pr2.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_suit.c$(ObjectSuffix) $(IntermediateDirectory)/src_main.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_pr1.c$(ObjectSuffix) 
+Objects0=$(IntermediateDirectory)/test_src_utils.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_pr2.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_suit.c$(ObjectSuffix) $(IntermediateDirectory)/src_main.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_pr1.c$(ObjectSuffix) $(IntermediateDirectory)/test_src_test_perf.c$(ObjectSuffix) 
 
 
 
@@ -134,6 +134,14 @@ $(IntermediateDirectory)/test_src_test_pr1.c$(PreprocessSuffix): test/src/test_p
 	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/test_src_test_pr1.c$(PreprocessSuffix) test/src/test_pr1.c
 
 
+$(IntermediateDirectory)/test_src_test_perf.c$(ObjectSuffix): test/src/test_perf.c $(IntermediateDirectory)/test_src_test_perf.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCCongress/test/src/test_perf.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/test_src_test_perf.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/test_src_test_perf.c$(DependSuffix): test/src/test_perf.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/test_src_test_perf.c$(ObjectSuffix) -MF$(IntermediateDirectory)/test_src_test_perf.c$(DependSuffix) -MM test/src/test_perf.c
+
+$(IntermediateDirectory)/test_src_test_perf.c$(PreprocessSuffix): test/src/test_perf.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/test_src_test_perf.c$(PreprocessSuffix) test/src/test_perf.c
+
 -include $(IntermediateDirectory)/*$(DependSuffix)
 ##
 ## Clean
@@ -3,6 +3,36 @@
 #include <string.h>
 #include <assert.h>
 #include "test_suit.h"
+#include "congress.h"
+#include "importer.h"
+#include "ingest.h"
+#include "rwlock.h"
+#include "thread.h"
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+// Number of presentations submitted by each producer of the benchmark
+#define BENCHMARK_PRESENTATIONS 200000
+
+// Maximum number of producers of the benchmark
+#define BENCHMARK_MAX_PRODUCERS 64
+
+// Length of the queue used to compare the recursive and iterative algorithms, and the longest one accepted. Each presentation is a call of the recursive algorithms, so longer queues can overflow the default stack of a thread.
+#define ALGORITHMS_PRESENTATIONS 2000
+#define ALGORITHMS_MAX_PRESENTATIONS 5000
+
+// Number of times each algorithm is run
+#define ALGORITHMS_ROUNDS 200
+
+// Producer of the benchmark, submitting to the lock free queue or to a queue protected by a lock
+typedef struct {
+    tIngestQueue* ingest;
+    tPresentationQueue* queue;
+    tRWLock* lock;
+    tGuestTable* guests;
+    int id;
+} tBenchmarkProducer;
 
 void waitKey() {
     printf("Press enter to end...");
@@ -13,6 +43,306 @@ void help(const char* name) {
     printf("%s\t =>\t Run all tests and show results on screen\n", name);
     printf("%s -h\t =>\t Show this help\n", name);
     printf("%s -e [<file_path>]\t =>\t Run all tests and save results on file (default test_result.json)\n", name);
+    printf("%s -i <file_path> [csv|jsonl]\t =>\t Import guests, organizations and presentations from a file (default csv, or jsonl for .jsonl files)\n", name);
+    printf("%s -b [<producers>]\t =>\t Compare the lock free ingest queue with a queue protected by a lock (default 4 producers)\n", name);
+    printf("%s -r [<presentations>]\t =>\t Compare the recursive and iterative algorithms of the presentation queues (default %d presentations, at most %d)\n", name, ALGORITHMS_PRESENTATIONS, ALGORITHMS_MAX_PRESENTATIONS);
+}
+
+double now() {
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+#endif
+}
+
+void submitIngest(void* arg) {
+    tBenchmarkProducer* producer = (tBenchmarkProducer*) arg;
+    char name[32];
+    int i;
+    
+    sprintf(name, "org%d", producer->id);
+    for(i=0; i<BENCHMARK_PRESENTATIONS; i++) {
+        ingestQueue_push(producer->ingest, name, i, "title", "topic");
+    }
+}
+
+void submitLocked(void* arg) {
+    tBenchmarkProducer* producer = (tBenchmarkProducer*) arg;
+    tPresentation presentation;
+    char name[32];
+    int i;
+    
+    sprintf(name, "org%d", producer->id);
+    memset(&presentation, 0, sizeof(tPresentation));
+    presentation.organization.name = name;
+    presentation.organization.guests = producer->guests;
+    presentation.presentationTitle = "title";
+    presentation.presentationTopic = "topic";
+    for(i=0; i<BENCHMARK_PRESENTATIONS; i++) {
+        presentation.score = i;
+        rwLock_writeLock(producer->lock);
+        presentationQueue_enqueue(producer->queue, presentation);
+        rwLock_writeUnlock(producer->lock);
+    }
+}
+
+// Drain the queue protected by the lock, taking all its presentations at once and adding them to the congress in batches
+unsigned int drainLocked(tCongress* congress, tPresentationQueue* queue, tRWLock* lock) {
+    tPresentationQueue taken;
+    tPresentationQueueIterator it;
+    tPresentationData rows[INGEST_BATCH_SIZE];
+    tPresentation* p;
+    unsigned int count, total;
+    
+    rwLock_writeLock(lock);
+    taken = *queue;
+    presentationQueue_createQueue(queue);
+    rwLock_writeUnlock(lock);
+    
+    count = 0;
+    total = 0;
+    for(presentationQueue_begin(&taken, &it); (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        rows[count].organizationName = p->organization.name;
+        rows[count].score = p->score;
+        rows[count].title = p->presentationTitle;
+        rows[count].topic = p->presentationTopic;
+        count++;
+        if(count == INGEST_BATCH_SIZE) {
+            congress_addPresentationsBatch(congress, rows, count, NULL);
+            total += count;
+            count = 0;
+        }
+    }
+    congress_addPresentationsBatch(congress, rows, count, NULL);
+    total += count;
+    presentationQueue_free(&taken);
+    
+    return total;
+}
+
+int benchmark(int producers) {
+    tBenchmarkProducer data[BENCHMARK_MAX_PRODUCERS];
+    tThread threads[BENCHMARK_MAX_PRODUCERS];
+    tCongress congress;
+    tGuestTable guests;
+    tOrganization organization;
+    tIngestQueue ingest;
+    tPresentationQueue queue;
+    tRWLock lock;
+    char name[32];
+    unsigned int total, expected;
+    double start, seconds;
+    int mode, i;
+    
+    if(producers < 1 || producers > BENCHMARK_MAX_PRODUCERS) {
+        printf("Invalid number of producers %d\n", producers);
+        return EXIT_FAILURE;
+    }
+    guestTable_init(&guests);
+    rwLock_init(&lock);
+    expected = producers * BENCHMARK_PRESENTATIONS;
+    
+    // The same presentations are submitted by the producers while this thread adds them to a congress, first with the lock free queue and then with the lock
+    for(mode=0; mode<2; mode++) {
+        congress_init(&congress, "benchmark");
+        for(i=0; i<producers; i++) {
+            sprintf(name, "org%d", i);
+            organization_init(&organization, name, &guests);
+            congress_registerOrganization(&congress, &organization);
+            organization_free(&organization);
+        }
+        ingestQueue_init(&ingest);
+        presentationQueue_createQueue(&queue);
+        
+        start = now();
+        for(i=0; i<producers; i++) {
+            data[i].ingest = &ingest;
+            data[i].queue = &queue;
+            data[i].lock = &lock;
+            data[i].guests = &guests;
+            data[i].id = i;
+            if(thread_start(&threads[i], (mode == 0) ? submitIngest : submitLocked, &data[i]) != OK) {
+                printf("Cannot start the producers\n");
+                return EXIT_FAILURE;
+            }
+        }
+        total = 0;
+        while(total < expected) {
+            if(mode == 0) {
+                total += congress_drainIngestQueue(&congress, &ingest, expected - total);
+            } else {
+                total += drainLocked(&congress, &queue, &lock);
+            }
+        }
+        for(i=0; i<producers; i++) {
+            thread_join(&threads[i]);
+        }
+        seconds = now() - start;
+        
+        printf("%s: %d producers, %u presentations in %.3f s: %.0f presentations/s\n", (mode == 0) ? "Lock free queue" : "Queue with lock", producers, total, seconds, total / seconds);
+        ingestQueue_free(&ingest);
+        presentationQueue_free(&queue);
+        congress_free(&congress);
+    }
+    
+    rwLock_free(&lock);
+    guestTable_free(&guests);
+    
+    return EXIT_SUCCESS;
+}
+
+// Show the time of the recursive and iterative versions of an algorithm
+void printAlgorithm(const char* algorithm, double recursive, double iterative, bool equal) {
+    printf("%s: recursive %.3f ms, iterative %.3f ms (%.2fx)%s\n", algorithm, recursive * 1000 / ALGORITHMS_ROUNDS, iterative * 1000 / ALGORITHMS_ROUNDS,
+        (iterative > 0) ? recursive / iterative : 0, equal ? "" : ", DIFFERENT RESULTS");
+}
+
+int compareAlgorithms(int count) {
+    tGuestTable guests;
+    tOrganization organization, other;
+    tPresentation presentation;
+    tPresentationQueue list, copy1, copy2, recursive, iterative;
+    double start, recursiveTime, iterativeTime, recursiveScore, iterativeScore;
+    bool equal, recursiveEqual, iterativeEqual;
+    int round, i;
+    
+    if(count < 1 || count > ALGORITHMS_MAX_PRESENTATIONS) {
+        printf("Invalid number of presentations %d\n", count);
+        return EXIT_FAILURE;
+    }
+    
+    // Half of the presentations belong to each organization
+    guestTable_init(&guests);
+    organization_init(&organization, "organization", &guests);
+    organization_init(&other, "other", &guests);
+    presentationQueue_createQueue(&list);
+    for(i=0; i<count; i++) {
+        presentation_init(&presentation, (i % 2 == 0) ? &organization : &other, i % 10, "title", "topic");
+        presentationQueue_enqueue(&list, presentation);
+        organization_free(&(presentation.organization));
+        free(presentation.presentationTitle);
+        free(presentation.presentationTopic);
+    }
+    
+    // Score of an organization
+    equal = true;
+    recursiveTime = 0;
+    iterativeTime = 0;
+    for(round=0; round<ALGORITHMS_ROUNDS; round++) {
+        start = now();
+        recursiveScore = presentationQueue_getOrganizationScoreRecursive(&list, &organization);
+        recursiveTime += now() - start;
+        start = now();
+        iterativeScore = presentationQueue_getOrganizationScoreIterative(&list, &organization);
+        iterativeTime += now() - start;
+        equal = equal && recursiveScore == iterativeScore;
+    }
+    printAlgorithm("Organization score", recursiveTime, iterativeTime, equal);
+    
+    // Presentations of an organization
+    equal = true;
+    recursiveTime = 0;
+    iterativeTime = 0;
+    for(round=0; round<ALGORITHMS_ROUNDS; round++) {
+        presentationQueue_createQueue(&recursive);
+        presentationQueue_createQueue(&iterative);
+        start = now();
+        presentationQueue_getOrganizationPresentationsRecursive(&list, &organization, &recursive);
+        recursiveTime += now() - start;
+        start = now();
+        presentationQueue_getOrganizationPresentationsIterative(&list, &organization, &iterative);
+        iterativeTime += now() - start;
+        equal = equal && presentationQueue_compare(recursive, iterative);
+        presentationQueue_free(&recursive);
+        presentationQueue_free(&iterative);
+    }
+    printAlgorithm("Organization presentations", recursiveTime, iterativeTime, equal);
+    
+    // Comparison of two equal queues. The algorithms empty the queues, so they are copied before each run.
+    equal = true;
+    recursiveTime = 0;
+    iterativeTime = 0;
+    for(round=0; round<ALGORITHMS_ROUNDS; round++) {
+        presentationQueue_duplicate(&copy1, list);
+        presentationQueue_duplicate(&copy2, list);
+        start = now();
+        recursiveEqual = presentationQueue_compareRecursive(&copy1, &copy2);
+        recursiveTime += now() - start;
+        presentationQueue_free(&copy1);
+        presentationQueue_free(&copy2);
+        presentationQueue_duplicate(&copy1, list);
+        presentationQueue_duplicate(&copy2, list);
+        start = now();
+        iterativeEqual = presentationQueue_compareIterative(&copy1, &copy2);
+        iterativeTime += now() - start;
+        presentationQueue_free(&copy1);
+        presentationQueue_free(&copy2);
+        equal = equal && recursiveEqual && iterativeEqual;
+    }
+    printAlgorithm("Queue comparison", recursiveTime, iterativeTime, equal);
+    
+    presentationQueue_free(&list);
+    organization_free(&organization);
+    organization_free(&other);
+    guestTable_free(&guests);
+    
+    return EXIT_SUCCESS;
+}
+
+int importFile(const char* path, const char* format) {
+    tCongress congress;
+    tGuestTable guests;
+    tImportStats stats;
+    tImportFormat importFormat;
+    FILE* fin = NULL;
+    tError err;
+    size_t length;
+    
+    // Take the format from the parameters, or from the extension of the file
+    length = strlen(path);
+    if(format != NULL) {
+        if(strcmp(format, "csv") == 0) {
+            importFormat = IMPORT_CSV;
+        } else if(strcmp(format, "jsonl") == 0) {
+            importFormat = IMPORT_JSON_LINES;
+        } else {
+            printf("Invalid format %s\n", format);
+            return EXIT_FAILURE;
+        }
+    } else if(length >= 6 && strcmp(path + length - 6, ".jsonl") == 0) {
+        importFormat = IMPORT_JSON_LINES;
+    } else {
+        importFormat = IMPORT_CSV;
+    }
+    
+    fin = fopen(path, "rb");
+    if(fin == NULL) {
+        printf("Cannot open %s\n", path);
+        return EXIT_FAILURE;
+    }
+    guestTable_init(&guests);
+    congress_init(&congress, (char*) path);
+    err = congress_import(&congress, &guests, fin, importFormat, &stats);
+    fclose(fin);
+    
+    printf("Imported %lu rows (%lu rejected, %.1f MB) in %.3f s: %.0f rows/s\n", stats.rows, stats.rejected, stats.bytes / 1048576.0, stats.seconds, stats.rowsPerSecond);
+    printf("Guests: %u, organizations: %u\n", guestTable_size(&guests), congress.organizations->size);
+    if(err != OK) {
+        printf("Import failed with error %d\n", err);
+    }
+    
+    congress_free(&congress);
+    guestTable_free(&guests);
+    
+    return (err == OK) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 int main(int argc, char **argv)
@@ -45,6 +375,15 @@ int main(int argc, char **argv)
             assert(fout != NULL);
             testSuite_export(&test_suite, fout);
             fclose(fout);
+        } else if(strcmp(argv[1], "-i") == 0 && argc > 2) {
+            // Import data from a file and show the import rate
+            return importFile(argv[2], (argc > 3) ? argv[3] : NULL);
+        } else if(strcmp(argv[1], "-b") == 0) {
+            // Measure the throughput of the queues of presentations with many producers
+            return benchmark((argc > 2) ? atoi(argv[2]) : 4);
+        } else if(strcmp(argv[1], "-r") == 0) {
+            // Measure the recursive and iterative algorithms of the presentation queues on the same data
+            return compareAlgorithms((argc > 2) ? atoi(argv[2]) : ALGORITHMS_PRESENTATIONS);
         } else {
             // Invalid parameters
             printf("Invalid parameters\n");
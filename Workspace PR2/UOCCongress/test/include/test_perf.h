@@ -0,0 +1,28 @@
+#ifndef __TEST_PERF_H__
+#define __TEST_PERF_H__
+
+#include <stdbool.h>
+#include "utils.h"
+
+// Run all tests for the performance extensions of the library
+bool run_perf(tTestSuite* test_suite);
+
+// Run tests for the guest tables
+bool run_perf_guests(tTestSection* test_section);
+
+// Run tests for the organization tables
+bool run_perf_organizations(tTestSection* test_section);
+
+// Run tests for the arena allocator
+bool run_perf_arena(tTestSection* test_section);
+
+// Run tests for the queues of presentations
+bool run_perf_queues(tTestSection* test_section);
+
+// Run tests for the queries of a congress
+bool run_perf_congress(tTestSection* test_section);
+
+// Run tests for the congresses shared by many threads
+bool run_perf_threads(tTestSection* test_section);
+
+#endif // __TEST_PERF_H__
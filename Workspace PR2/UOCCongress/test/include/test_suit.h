@@ -3,6 +3,7 @@
 
 #include "test_pr1.h"
 #include "test_pr2.h"
+#include "test_perf.h"
 
 // Run all available tests
 bool run_all(tTestSuite* test_suite);
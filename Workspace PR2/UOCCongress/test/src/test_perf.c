@@ -0,0 +1,2003 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_perf.h"
+#include "guest.h"
+#include "organization.h"
+#include "presentation.h"
+#include "congress.h"
+#include "snapshot.h"
+#include "importer.h"
+#include "exporter.h"
+#include "wal.h"
+#include "shared.h"
+#include "thread.h"
+#include "ingest.h"
+
+// Number of elements used on the tests with large tables
+#define PERF_NUM_ELEMENTS 2000
+
+// Number of organizations and of topics used on the tests of a congress
+#define PERF_NUM_GROUPS (PERF_NUM_ELEMENTS / 100)
+
+// Number of threads that read and that change a shared congress
+#define PERF_NUM_READERS 4
+#define PERF_NUM_WRITERS 2
+
+// Data of a thread of the tests
+typedef struct {
+    tSharedCongress* congress;
+    tIngestQueue* queue;
+    unsigned int id;
+    bool failed;
+} tPerfThreadData;
+
+// Submit presentations to an ingest queue while a consumer drains it. Each thread submits the presentations of its own organization, with increasing scores.
+static void perf_submitPresentations(void* arg) {
+    tPerfThreadData* data = (tPerfThreadData*) arg;
+    char name[32];
+    int i;
+    
+    sprintf(name, "org%d", data->id);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        if(ingestQueue_push(data->queue, name, i, "title", "topic") != OK) {
+            data->failed = true;
+        }
+    }
+}
+
+// Query a shared congress while other threads change it. All the scores are 1, so the score of an organization is always its number of presentations.
+static void perf_readCongress(void* arg) {
+    tPerfThreadData* data = (tPerfThreadData*) arg;
+    tPresentationQueue presentations;
+    tScoreStats stats;
+    unsigned int last[PERF_NUM_GROUPS];
+    char name[32], topic[32];
+    int i, wins;
+    
+    memset(last, 0, sizeof(last));
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "org%d", i % PERF_NUM_GROUPS);
+        sprintf(topic, "topic%d", i % 7);
+        if(sharedCongress_getOrganizationStats(data->congress, name, &stats) != OK || stats.sum != stats.count || stats.count < last[i % PERF_NUM_GROUPS]) {
+            data->failed = true;
+        }
+        last[i % PERF_NUM_GROUPS] = stats.count;
+        wins = sharedCongress_getOrganizationWins(data->congress, name, topic);
+        if(wins != 0 && wins != 1 && wins != 3 && wins != ERR_NOT_EXISTS) {
+            data->failed = true;
+        }
+        if(i % 100 == data->id) {
+            presentationQueue_createQueue(&presentations);
+            if(sharedCongress_getOrganizationPresentations(data->congress, name, &presentations) != OK) {
+                data->failed = true;
+            }
+            while(!presentationQueue_empty(presentations)) {
+                if(presentationQueue_head(presentations)->score != 1) {
+                    data->failed = true;
+                }
+                presentationQueue_dequeue(&presentations);
+            }
+            presentationQueue_free(&presentations);
+        }
+    }
+}
+
+// Add presentations to a shared congress while other threads query it. Odd threads add them in batches.
+static void perf_writeCongress(void* arg) {
+    tPerfThreadData* data = (tPerfThreadData*) arg;
+    tPresentationData rows[100];
+    char names[PERF_NUM_GROUPS][32], topics[7][32];
+    int i;
+    
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(names[i], "org%d", i);
+    }
+    for(i=0; i<7; i++) {
+        sprintf(topics[i], "topic%d", i);
+    }
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        if(data->id % 2 == 0) {
+            if(sharedCongress_addPresentation(data->congress, names[i % PERF_NUM_GROUPS], 1, "title", topics[i % 7]) != OK) {
+                data->failed = true;
+            }
+            continue;
+        }
+        rows[i % 100].organizationName = names[i % PERF_NUM_GROUPS];
+        rows[i % 100].score = 1;
+        rows[i % 100].title = "title";
+        rows[i % 100].topic = topics[i % 7];
+        if(i % 100 == 99 && sharedCongress_addPresentationsBatch(data->congress, rows, 100, NULL) != 100) {
+            data->failed = true;
+        }
+    }
+}
+
+// Run all tests for the performance extensions of the library
+bool run_perf(tTestSuite* test_suite) {
+    bool ok = true;
+    tTestSection* section = NULL;
+    
+    assert(test_suite != NULL);
+    
+    testSuite_addSection(test_suite, "PERF", "Tests for performance extensions");
+    
+    section = testSuite_getSection(test_suite, "PERF");
+    assert(section != NULL);
+        
+    ok = run_perf_guests(section) && ok;
+    ok = run_perf_organizations(section) && ok;
+    ok = run_perf_arena(section) && ok;
+    ok = run_perf_queues(section) && ok;
+    ok = run_perf_congress(section) && ok;
+    ok = run_perf_threads(section) && ok;
+        
+    return ok;
+}
+
+// Run tests for the guest tables
+bool run_perf_guests(tTestSection* test_section) {
+    bool passed = true, failed = false;
+    tGuest g, *gAux;
+    tGuestTable guests, same, sorted;
+    tGuest* batch;
+    char username[32], mail[64];
+    int i;
+    
+    guestTable_init(&guests);
+    
+    // TEST 1: Find guests on a large table
+    failed = false;
+    start_test(test_section, "PERF_GUESTS_1", "Find guests on a large table");
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        sprintf(mail, "user%d@uoc.edu", i);
+        guest_init(&g, username, "name", mail);
+        if(guestTable_add(&guests, &g) != OK) {
+            failed = true;
+        }
+        guest_free(&g);
+    }
+    
+    if(guestTable_size(&guests) != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        gAux = guestTable_find(&guests, username);
+        if(gAux == NULL || strcmp(gAux->username, username) != 0) {
+            failed = true;
+        }
+    }
+    
+    if(guestTable_find(&guests, "user") != NULL) {
+        failed = true;
+    }
+    
+    // Duplicated usernames are rejected
+    guest_init(&g, "user7", "other name", "other@uoc.edu");
+    if(guestTable_add(&guests, &g) != ERR_DUPLICATED) {
+        failed = true;
+    }
+    guest_free(&g);
+    
+    if(failed) {
+        end_test(test_section, "PERF_GUESTS_1", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_GUESTS_1", true);
+    }
+    
+    // TEST 2: Remove guests from a large table
+    failed = false;
+    start_test(test_section, "PERF_GUESTS_2", "Remove guests from a large table");
+    
+    // Remove the even guests
+    for(i=0; i<PERF_NUM_ELEMENTS; i+=2) {
+        sprintf(username, "user%d", i);
+        gAux = guestTable_find(&guests, username);
+        if(gAux == NULL || guestTable_remove(&guests, gAux) != OK) {
+            failed = true;
+        }
+    }
+    
+    if(guestTable_size(&guests) != PERF_NUM_ELEMENTS / 2) {
+        failed = true;
+    }
+    
+    // Only the odd guests can be found, and the order of the table is kept
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        gAux = guestTable_find(&guests, username);
+        if(i % 2 == 0) {
+            if(gAux != NULL) {
+                failed = true;
+            }
+        } else if(gAux == NULL || gAux != &(guests.elements[i / 2]) || strcmp(gAux->username, username) != 0) {
+            failed = true;
+        }
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_GUESTS_2", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_GUESTS_2", true);
+    }
+    
+    // TEST 3: Reserve the memory of a table
+    failed = false;
+    start_test(test_section, "PERF_GUESTS_3", "Reserve the memory of a table");
+    
+    guestTable_free(&guests);
+    if(guestTable_reserve(&guests, PERF_NUM_ELEMENTS) != OK) {
+        failed = true;
+    }
+    if(guests.capacity < PERF_NUM_ELEMENTS || guestTable_size(&guests) != 0) {
+        failed = true;
+    }
+    
+    // Adding the reserved number of elements do not move the memory
+    gAux = guests.elements;
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        guest_init(&g, username, "name", "user@uoc.edu");
+        guestTable_add(&guests, &g);
+        guest_free(&g);
+    }
+    if(guests.elements != gAux || guestTable_size(&guests) != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    
+    // The memory shrinks when the elements are removed, and is released when the table is empty
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        if(guests.capacity < guests.size || guests.capacity > 4 * guests.size + GUEST_TABLE_MIN_CAPACITY) {
+            failed = true;
+        }
+        sprintf(username, "user%d", i);
+        if(guestTable_remove(&guests, guestTable_find(&guests, username)) != OK) {
+            failed = true;
+        }
+    }
+    if(guests.elements != NULL || guests.capacity != 0) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_GUESTS_3", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_GUESTS_3", true);
+    }
+    
+    // TEST 4: Remove guests without keeping the order
+    failed = false;
+    start_test(test_section, "PERF_GUESTS_4", "Remove guests without keeping the order");
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        guest_init(&g, username, "name", "user@uoc.edu");
+        guestTable_add(&guests, &g);
+        guest_free(&g);
+    }
+    
+    // Remove the first guests. Each one is replaced by the last guest of the table.
+    for(i=0; i<PERF_NUM_ELEMENTS / 2; i++) {
+        sprintf(username, "user%d", i);
+        if(guestTable_removeUnordered(&guests, guestTable_find(&guests, username)) != OK) {
+            failed = true;
+        }
+    }
+    sprintf(username, "user%d", PERF_NUM_ELEMENTS - 1);
+    if(guestTable_size(&guests) != PERF_NUM_ELEMENTS / 2 || strcmp(guests.elements[0].username, username) != 0) {
+        failed = true;
+    }
+    
+    // All the remaining guests can be found on their new position
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        gAux = guestTable_find(&guests, username);
+        if(i < PERF_NUM_ELEMENTS / 2) {
+            if(gAux != NULL) {
+                failed = true;
+            }
+        } else if(gAux == NULL || strcmp(gAux->username, username) != 0) {
+            failed = true;
+        }
+    }
+    
+    guest_init(&g, "user0", "name", "user@uoc.edu");
+    if(guestTable_removeUnordered(&guests, &g) != ERR_NOT_FOUND) {
+        failed = true;
+    }
+    guest_free(&g);
+    
+    if(failed) {
+        end_test(test_section, "PERF_GUESTS_4", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_GUESTS_4", true);
+    }
+    
+    // TEST 5: Compare large tables
+    failed = false;
+    start_test(test_section, "PERF_GUESTS_5", "Compare large tables");
+    
+    // The same guests in the same order, and in a different order
+    guestTable_init(&same);
+    guestTable_init(&sorted);
+    for(i=0; i<guests.size; i++) {
+        guestTable_add(&same, &(guests.elements[i]));
+    }
+    for(i=PERF_NUM_ELEMENTS / 2; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        guestTable_add(&sorted, guestTable_find(&guests, username));
+    }
+    if(!guestTable_equals(&guests, &same) || !guestTable_equals(&same, &guests) || !guestTable_equals(&guests, &sorted) || !guestTable_equals(&sorted, &guests)) {
+        failed = true;
+    }
+    
+    // A different guest at the end is found both comparing a few guests and a large number of them
+    sprintf(username, "user%d", PERF_NUM_ELEMENTS - 1);
+    guest_init(&g, username, "name", "user@uoc.edu");
+    guestTable_remove(&sorted, &g);
+    guest_free(&g);
+    guest_init(&g, "user0", "name", "user@uoc.edu");
+    guestTable_add(&sorted, &g);
+    guest_free(&g);
+    if(guestTable_equals(&guests, &sorted) || guestTable_equals(&sorted, &guests)) {
+        failed = true;
+    }
+    for(i=0; i<PERF_NUM_ELEMENTS / 2 - GUEST_TABLE_EQUALS_SCAN_THRESHOLD / 2; i++) {
+        guestTable_removeUnordered(&same, &(same.elements[same.size - 1]));
+        guestTable_removeUnordered(&sorted, &(sorted.elements[0]));
+    }
+    if(guestTable_equals(&same, &sorted)) {
+        failed = true;
+    }
+    guestTable_free(&same);
+    guestTable_free(&sorted);
+    
+    // A few guests in a different order are compared scanning them
+    for(i=0; i<GUEST_TABLE_EQUALS_SCAN_THRESHOLD / 2; i++) {
+        guestTable_add(&same, &(guests.elements[i]));
+        guestTable_add(&sorted, &(guests.elements[GUEST_TABLE_EQUALS_SCAN_THRESHOLD / 2 - 1 - i]));
+    }
+    if(!guestTable_equals(&same, &sorted) || !guestTable_equals(&sorted, &same)) {
+        failed = true;
+    }
+    guestTable_free(&same);
+    guestTable_free(&sorted);
+    
+    if(failed) {
+        end_test(test_section, "PERF_GUESTS_5", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_GUESTS_5", true);
+    }
+    
+    // TEST 6: Add many guests at once
+    failed = false;
+    start_test(test_section, "PERF_GUESTS_6", "Add many guests at once");
+    
+    // The array repeats each guest twice, and half of them are already on the table
+    batch = (tGuest*) malloc(2 * PERF_NUM_ELEMENTS * sizeof(tGuest));
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        sprintf(mail, "user%d@uoc.edu", i);
+        guest_init(&(batch[2 * i]), username, "name", mail);
+        guest_init(&(batch[2 * i + 1]), username, "other name", mail);
+    }
+    if(guestTable_addMany(&guests, batch, 2 * PERF_NUM_ELEMENTS) != ERR_DUPLICATED) {
+        failed = true;
+    }
+    if(guestTable_size(&guests) != PERF_NUM_ELEMENTS || guests.capacity > 2 * PERF_NUM_ELEMENTS + guests.size) {
+        failed = true;
+    }
+    
+    // The first copy of each guest is added, after the guests that were already on the table
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(username, "user%d", i);
+        gAux = guestTable_find(&guests, username);
+        if(gAux == NULL || (i < PERF_NUM_ELEMENTS / 2 && strcmp(gAux->name, "name") != 0)) {
+            failed = true;
+        }
+        if(i < PERF_NUM_ELEMENTS / 2 && gAux != &(guests.elements[PERF_NUM_ELEMENTS / 2 + i])) {
+            failed = true;
+        }
+    }
+    
+    // A batch without repeated guests is added completely
+    guestTable_init(&same);
+    guestTable_init(&sorted);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        guestTable_add(&same, &(batch[2 * i]));
+    }
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        guest_free(&(batch[2 * i + 1]));
+        batch[i] = batch[2 * i];
+    }
+    if(guestTable_addMany(&sorted, batch, PERF_NUM_ELEMENTS) != OK || sorted.capacity != PERF_NUM_ELEMENTS || !guestTable_equals(&same, &sorted)) {
+        failed = true;
+    }
+    guestTable_free(&same);
+    guestTable_free(&sorted);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        guest_free(&(batch[i]));
+    }
+    free(batch);
+    
+    if(failed) {
+        end_test(test_section, "PERF_GUESTS_6", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_GUESTS_6", true);
+    }
+    
+    // Remove used data
+    guestTable_free(&guests);
+    
+    return passed;
+}
+
+// Run tests for the organization tables
+bool run_perf_organizations(tTestSection* test_section) {
+    bool passed = true, failed = false;
+    tGuestTable guests, guests1, guests2;
+    tGuest guest;
+    tOrganization org, orgMoved, *orgAux;
+    tPresentation presentation;
+    tPresentationQueue queue;
+    tArena arena;
+    tOrganizationTable organizations;
+    char name[32], *nameAux;
+    int i;
+    
+    guestTable_init(&guests);
+    organizationTable_init(&organizations);
+    
+    // TEST 1: Add and remove organizations on a large table
+    failed = false;
+    start_test(test_section, "PERF_ORGANIZATIONS_1", "Add and remove organizations on a large table");
+    
+    if(organizationTable_reserve(&organizations, PERF_NUM_ELEMENTS / 2) != OK || organizations.capacity < PERF_NUM_ELEMENTS / 2) {
+        failed = true;
+    }
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "org%d", i);
+        organization_init(&org, name, &guests);
+        if(organizationTable_add(&organizations, &org) != OK) {
+            failed = true;
+        }
+        organization_free(&org);
+    }
+    if(organizationTable_size(&organizations) != PERF_NUM_ELEMENTS || organizations.capacity < PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    
+    // Remove the first half of organizations. The order of the remaining ones is kept.
+    for(i=0; i<PERF_NUM_ELEMENTS / 2; i++) {
+        sprintf(name, "org%d", i);
+        orgAux = organizationTable_find(&organizations, name);
+        if(orgAux == NULL || organizationTable_remove(&organizations, orgAux) != OK) {
+            failed = true;
+        }
+    }
+    if(organizationTable_size(&organizations) != PERF_NUM_ELEMENTS / 2) {
+        failed = true;
+    }
+    for(i=0; i<PERF_NUM_ELEMENTS / 2; i++) {
+        sprintf(name, "org%d", i + PERF_NUM_ELEMENTS / 2);
+        if(strcmp(organizations.elements[i].name, name) != 0) {
+            failed = true;
+        }
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_ORGANIZATIONS_1", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_ORGANIZATIONS_1", true);
+    }
+    
+    // TEST 2: Move organizations instead of copying them
+    failed = false;
+    start_test(test_section, "PERF_ORGANIZATIONS_2", "Move organizations instead of copying them");
+    
+    // The destination takes the name of the source, which is left empty
+    organization_init(&org, "moved", &guests);
+    nameAux = org.name;
+    organization_move(&orgMoved, &org);
+    if(orgMoved.name != nameAux || orgMoved.guests != &guests || org.name != NULL || org.guests != NULL) {
+        failed = true;
+    }
+    organization_free(&orgMoved);
+    
+    // Removing an organization moves the next ones, keeping their names on the same memory
+    nameAux = organizations.elements[1].name;
+    if(organizationTable_remove(&organizations, &(organizations.elements[0])) != OK) {
+        failed = true;
+    }
+    sprintf(name, "org%d", PERF_NUM_ELEMENTS / 2 + 1);
+    if(organizations.elements[0].name != nameAux || strcmp(organizations.elements[0].name, name) != 0) {
+        failed = true;
+    }
+    if(organizationTable_size(&organizations) != PERF_NUM_ELEMENTS / 2 - 1) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_ORGANIZATIONS_2", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_ORGANIZATIONS_2", true);
+    }
+    
+    // TEST 3: Compare organizations by identifier and content hash
+    failed = false;
+    start_test(test_section, "PERF_ORGANIZATIONS_3", "Compare organizations by identifier and content hash");
+    
+    // The same guests added in a different order give the same content hash
+    guestTable_init(&guests1);
+    guestTable_init(&guests2);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "guest%d", i);
+        guest_init(&guest, name, "name", "guest@uoc.edu");
+        guestTable_add(&guests1, &guest);
+        guest_free(&guest);
+        sprintf(name, "guest%d", PERF_NUM_ELEMENTS - 1 - i);
+        guest_init(&guest, name, "name", "guest@uoc.edu");
+        guestTable_add(&guests2, &guest);
+        guest_free(&guest);
+    }
+    if(guests1.contentHash != guests2.contentHash || !guestTable_equals(&guests1, &guests2)) {
+        failed = true;
+    }
+    
+    // Removing a guest changes the hash, and adding it again restores it
+    guestTable_removeUnordered(&guests2, &(guests2.elements[0]));
+    guest_init(&guest, "other", "name", "guest@uoc.edu");
+    guestTable_add(&guests2, &guest);
+    guest_free(&guest);
+    if(guests1.contentHash == guests2.contentHash || guestTable_equals(&guests1, &guests2)) {
+        failed = true;
+    }
+    guest_init(&guest, "other", "name", "guest@uoc.edu");
+    guestTable_remove(&guests2, &guest);
+    guest_free(&guest);
+    sprintf(name, "guest%d", PERF_NUM_ELEMENTS - 1);
+    guest_init(&guest, name, "name", "guest@uoc.edu");
+    guestTable_add(&guests2, &guest);
+    guest_free(&guest);
+    if(guests1.contentHash != guests2.contentHash || !guestTable_equals(&guests1, &guests2)) {
+        failed = true;
+    }
+    
+    // Copies keep the identifier of the organization, and new organizations get a different one
+    organization_init(&org, "org", &guests1);
+    organization_init(&orgMoved, "other", &guests1);
+    if(org.id == 0 || org.id == orgMoved.id) {
+        failed = true;
+    }
+    organization_free(&orgMoved);
+    organization_cpy(&orgMoved, &org);
+    if(orgMoved.id != org.id || !organization_equals(&org, &orgMoved)) {
+        failed = true;
+    }
+    if(organizationTable_add(&organizations, &org) != OK || organizationTable_find(&organizations, "org")->id != org.id) {
+        failed = true;
+    }
+    
+    // Organizations with different identifiers are compared by their fields
+    organization_free(&orgMoved);
+    organization_init(&orgMoved, "org", &guests2);
+    if(orgMoved.id == org.id || !organization_equals(&org, &orgMoved)) {
+        failed = true;
+    }
+    guestTable_remove(&guests2, &(guests2.elements[0]));
+    if(organization_equals(&org, &orgMoved)) {
+        failed = true;
+    }
+    organization_free(&orgMoved);
+    organization_free(&org);
+    guestTable_free(&guests1);
+    guestTable_free(&guests2);
+    
+    if(failed) {
+        end_test(test_section, "PERF_ORGANIZATIONS_3", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_ORGANIZATIONS_3", true);
+    }
+    
+    // TEST 4: Share the name of an organization between its copies
+    failed = false;
+    start_test(test_section, "PERF_ORGANIZATIONS_4", "Share the name of an organization between its copies");
+    
+    // The presentations and their copies use the name of the organization
+    organization_init(&org, "shared", &guests);
+    presentationQueue_createQueue(&queue);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        presentation_init(&presentation, &org, 1.0, "title", "topic");
+        presentationQueue_enqueue(&queue, presentation);
+        if(presentation.organization.name != org.name || presentationQueue_last(queue)->organization.name != org.name) {
+            failed = true;
+        }
+    }
+    if(org.references == NULL || *(org.references) != 2 * PERF_NUM_ELEMENTS + 1) {
+        failed = true;
+    }
+    
+    // The name is kept while any copy uses it
+    organization_cpy(&orgMoved, &org);
+    organization_free(&org);
+    if(orgMoved.references == NULL || *(orgMoved.references) != 2 * PERF_NUM_ELEMENTS + 1 || strcmp(presentationQueue_head(queue)->organization.name, "shared") != 0) {
+        failed = true;
+    }
+    organization_free(&orgMoved);
+    
+    // Organizations with a name taken from an arena are copied, since the arena can be released first
+    arena_init(&arena);
+    organization_initArena(&org, &arena, "arena", &guests);
+    organization_cpy(&orgMoved, &org);
+    if(org.references != NULL || orgMoved.name == org.name || orgMoved.references == NULL || strcmp(orgMoved.name, "arena") != 0) {
+        failed = true;
+    }
+    arena_free(&arena);
+    organization_free(&orgMoved);
+    presentationQueue_free(&queue);
+    
+    if(failed) {
+        end_test(test_section, "PERF_ORGANIZATIONS_4", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_ORGANIZATIONS_4", true);
+    }
+    
+    // Remove used data
+    organizationTable_free(&organizations);
+    guestTable_free(&guests);
+    
+    return passed;
+}
+
+// Run tests for the arena allocator
+bool run_perf_arena(tTestSection* test_section) {
+    bool passed = true, failed = false;
+    tArena arena;
+    tGuestTable guests;
+    tOrganization org;
+    tCongress congress;
+    tPresentationQueue presentations;
+    char name[32], *strings[PERF_NUM_ELEMENTS], *big;
+    int i;
+    
+    arena_init(&arena);
+    guestTable_init(&guests);
+    
+    // TEST 1: Allocate strings from an arena
+    failed = false;
+    start_test(test_section, "PERF_ARENA_1", "Allocate strings from an arena");
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "string%d", i);
+        strings[i] = arena_strdup(&arena, name);
+        if(strings[i] == NULL) {
+            failed = true;
+        }
+    }
+    
+    // Values larger than a block are also allocated
+    big = (char*) arena_alloc(&arena, 2 * ARENA_BLOCK_SIZE);
+    if(big == NULL) {
+        failed = true;
+    } else {
+        memset(big, 'x', 2 * ARENA_BLOCK_SIZE);
+    }
+    
+    // No value is overwritten by the next ones
+    for(i=0; i<PERF_NUM_ELEMENTS && !failed; i++) {
+        sprintf(name, "string%d", i);
+        if(strcmp(strings[i], name) != 0) {
+            failed = true;
+        }
+    }
+    
+    arena_free(&arena);
+    if(arena.blocks != NULL) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_ARENA_1", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_ARENA_1", true);
+    }
+    
+    // TEST 2: Store the strings of a congress on its arena
+    failed = false;
+    start_test(test_section, "PERF_ARENA_2", "Store the strings of a congress on its arena");
+    
+    congress_init(&congress, "congress");
+    for(i=0; i<PERF_NUM_ELEMENTS / 10; i++) {
+        sprintf(name, "org%d", i);
+        organization_init(&org, name, &guests);
+        if(congress_registerOrganization(&congress, &org) != OK) {
+            failed = true;
+        }
+        organization_free(&org);
+    }
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "org%d", i % (PERF_NUM_ELEMENTS / 10));
+        if(congress_addPresentation(&congress, name, i, "title", "topic") != OK) {
+            failed = true;
+        }
+    }
+    
+    // Removed organizations do not release their name, it is owned by the arena
+    organization_init(&org, "org0", &guests);
+    if(congress_removeOrganization(&congress, &org) != OK || congress_findOrganization(&congress, "org0") != NULL) {
+        failed = true;
+    }
+    organization_free(&org);
+    
+    // The presentations copied out of the congress are still valid once it is removed
+    presentationQueue_createQueue(&presentations);
+    sprintf(name, "org%d", (PERF_NUM_ELEMENTS - 1) % (PERF_NUM_ELEMENTS / 10));
+    if(congress_getOrganizationPresentations(&congress, name, &presentations) != OK) {
+        failed = true;
+    }
+    congress_free(&congress);
+    if(presentationQueue_empty(presentations) || strcmp(presentationQueue_head(presentations)->presentationTopic, "topic") != 0) {
+        failed = true;
+    }
+    presentationQueue_free(&presentations);
+    
+    if(failed) {
+        end_test(test_section, "PERF_ARENA_2", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_ARENA_2", true);
+    }
+    
+    // Remove used data
+    guestTable_free(&guests);
+    
+    return passed;
+}
+
+// Run tests for the queues of presentations
+bool run_perf_queues(tTestSection* test_section) {
+    bool passed = true, failed = false;
+    tGuestTable guests;
+    tOrganization org, other;
+    tPresentation presentation, *pAux;
+    tPresentationQueue ring, list, copy;
+    tPresentationNodePool pool;
+    tPresentationNodePoolStats stats, reserved;
+    tPresentationQueueIterator it;
+    tCongress congress;
+    char title[32];
+    double score;
+    int i;
+    
+    guestTable_init(&guests);
+    organization_init(&org, "org", &guests);
+    
+    // TEST 1: Enqueue and dequeue on a ring queue
+    failed = false;
+    start_test(test_section, "PERF_QUEUES_1", "Enqueue and dequeue on a ring queue");
+    
+    presentationQueue_createQueueType(&ring, PRESENTATION_QUEUE_RING, NULL);
+    if(!presentationQueue_empty(ring) || presentationQueue_head(ring) != NULL) {
+        failed = true;
+    }
+    
+    // Alternate enqueues and dequeues, so the elements wrap around the end of the array
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(title, "title%d", i);
+        presentation_init(&presentation, &org, i, title, "topic");
+        if(presentationQueue_enqueue(&ring, presentation) != OK) {
+            failed = true;
+        }
+        if(i % 3 == 2) {
+            presentationQueue_dequeue(&ring);
+        }
+    }
+    
+    // The queue keeps the order of the presentations
+    for(i=PERF_NUM_ELEMENTS / 3; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(title, "title%d", i);
+        pAux = presentationQueue_head(ring);
+        if(pAux == NULL || strcmp(pAux->presentationTitle, title) != 0 || pAux->score != i) {
+            failed = true;
+            break;
+        }
+        // The copy of a ring queue has the same presentations
+        if(i == PERF_NUM_ELEMENTS / 3) {
+            presentationQueue_duplicate(&list, ring);
+            if(!presentationQueue_compare(list, ring)) {
+                failed = true;
+            }
+            presentationQueue_free(&list);
+        }
+        presentationQueue_dequeue(&ring);
+    }
+    if(!presentationQueue_empty(ring) || presentationQueue_head(ring) != NULL) {
+        failed = true;
+    }
+    presentationQueue_free(&ring);
+    if(ring.elements != NULL || ring.capacity != 0) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_QUEUES_1", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_QUEUES_1", true);
+    }
+    
+    // TEST 2: Query a congress with a ring queue
+    failed = false;
+    start_test(test_section, "PERF_QUEUES_2", "Query a congress with a ring queue");
+    
+    congress_initQueueType(&congress, "congress", PRESENTATION_QUEUE_RING);
+    congress_registerOrganization(&congress, &org);
+    organization_free(&org);
+    organization_init(&org, "other", &guests);
+    congress_registerOrganization(&congress, &org);
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(title, "title%d", i);
+        congress_addPresentation(&congress, i % 2 == 0 ? "org" : "other", i % 2 == 0 ? 2.0 : 1.0, title, "topic");
+    }
+    if(congress.presentations.first != NULL || congress.presentations.count != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    if(congress_getOrganizationWins(&congress, "org", "topic") != 3 || congress_getOrganizationWins(&congress, "other", "topic") != 0) {
+        failed = true;
+    }
+    if(congress_getOrganizationScore(&congress, "org") != PERF_NUM_ELEMENTS || congress_getOrganizationScore(&congress, "other") != PERF_NUM_ELEMENTS / 2) {
+        failed = true;
+    }
+    congress_free(&congress);
+    
+    if(failed) {
+        end_test(test_section, "PERF_QUEUES_2", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_QUEUES_2", true);
+    }
+    
+    // TEST 3: Recycle the nodes of a queue on a pool
+    failed = false;
+    start_test(test_section, "PERF_QUEUES_3", "Recycle the nodes of a queue on a pool");
+    
+    presentationNodePool_init(&pool);
+    presentationQueue_createQueue(&list);
+    presentationQueue_setPool(&list, &pool);
+    presentation_init(&presentation, &org, 1.0, "title", "topic");
+    
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        presentationQueue_enqueue(&list, presentation);
+    }
+    stats = presentationNodePool_getStats(&pool);
+    if(stats.used != PERF_NUM_ELEMENTS || stats.nodes < PERF_NUM_ELEMENTS || stats.slabs != (PERF_NUM_ELEMENTS + PRESENTATION_NODE_POOL_SLAB_SIZE - 1) / PRESENTATION_NODE_POOL_SLAB_SIZE || stats.reuses != 0) {
+        failed = true;
+    }
+    
+    // Dequeued nodes are used again, so no more slabs are allocated
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        presentationQueue_dequeue(&list);
+        presentationQueue_enqueue(&list, presentation);
+    }
+    presentationQueue_free(&list);
+    stats = presentationNodePool_getStats(&pool);
+    if(stats.used != 0 || stats.peak != PERF_NUM_ELEMENTS || stats.requests != 2 * PERF_NUM_ELEMENTS || stats.reuses != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    if(stats.slabs != (PERF_NUM_ELEMENTS + PRESENTATION_NODE_POOL_SLAB_SIZE - 1) / PRESENTATION_NODE_POOL_SLAB_SIZE) {
+        failed = true;
+    }
+    
+    // The nodes reserved for a list queue are allocated at once, so enqueuing them allocates no more slabs
+    presentationQueue_createQueue(&list);
+    presentationQueue_setPool(&list, &pool);
+    if(presentationQueue_reserve(&list, 3 * PERF_NUM_ELEMENTS) != OK) {
+        failed = true;
+    }
+    reserved = presentationNodePool_getStats(&pool);
+    for(i=0; i<3 * PERF_NUM_ELEMENTS; i++) {
+        presentationQueue_enqueue(&list, presentation);
+    }
+    stats = presentationNodePool_getStats(&pool);
+    if(reserved.nodes < 3 * PERF_NUM_ELEMENTS || reserved.nodes >= 3 * PERF_NUM_ELEMENTS + PRESENTATION_NODE_POOL_SLAB_SIZE || stats.slabs != reserved.slabs || stats.used != 3 * PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    presentationQueue_free(&list);
+    
+    presentationNodePool_free(&pool);
+    if(pool.slabs != NULL || pool.spare != NULL || presentationNodePool_getStats(&pool).nodes != 0) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_QUEUES_3", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_QUEUES_3", true);
+    }
+    
+    // TEST 4: Walk a queue with a cursor
+    failed = false;
+    start_test(test_section, "PERF_QUEUES_4", "Walk a queue with a cursor");
+    
+    presentationQueue_createQueue(&list);
+    presentationQueue_createQueueType(&ring, PRESENTATION_QUEUE_RING, NULL);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(title, "title%d", i);
+        presentation_init(&presentation, &org, i, title, "topic");
+        presentationQueue_enqueue(&list, presentation);
+        presentationQueue_enqueue(&ring, presentation);
+    }
+    
+    // Both types of queue are walked from the head to the last presentation
+    i = 0;
+    for(presentationQueue_begin(&ring, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        if(pAux->score != i) {
+            failed = true;
+        }
+        i++;
+    }
+    if(i != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    i = 0;
+    for(presentationQueue_begin(&list, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        if(pAux->score != i) {
+            failed = true;
+        }
+        i++;
+    }
+    if(i != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    
+    // The comparison walks the queues without modifying them
+    pAux = presentationQueue_head(list);
+    if(!presentationQueue_compare(list, ring) || presentationQueue_head(list) != pAux || ring.count != PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    presentationQueue_dequeue(&ring);
+    if(presentationQueue_compare(list, ring) || presentationQueue_compare(ring, list)) {
+        failed = true;
+    }
+    
+    presentationQueue_free(&list);
+    presentationQueue_free(&ring);
+    
+    if(failed) {
+        end_test(test_section, "PERF_QUEUES_4", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_QUEUES_4", true);
+    }
+    
+    // TEST 5: Query a long queue without recursion
+    failed = false;
+    start_test(test_section, "PERF_QUEUES_5", "Query a long queue without recursion");
+    
+    organization_init(&other, "another", &guests);
+    presentationQueue_createQueue(&list);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        presentation_init(&presentation, i % 2 == 0 ? &org : &other, i % 7, "title", "topic");
+        presentationQueue_enqueue(&list, presentation);
+    }
+    
+    // The iterative and recursive algorithms give the same results
+    if(presentationQueue_getOrganizationScoreIterative(&list, &org) != presentationQueue_getOrganizationScoreRecursive(&list, &org)) {
+        failed = true;
+    }
+    presentationQueue_createQueue(&ring);
+    presentationQueue_createQueue(&copy);
+    if(presentationQueue_getOrganizationPresentationsIterative(&list, &other, &ring) != OK || presentationQueue_getOrganizationPresentationsRecursive(&list, &other, &copy) != OK) {
+        failed = true;
+    }
+    if(!presentationQueue_compare(ring, copy)) {
+        failed = true;
+    }
+    i = 0;
+    for(presentationQueue_begin(&ring, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        if(!organization_equals(&(pAux->organization), &other)) {
+            failed = true;
+        }
+        i++;
+    }
+    if(i != PERF_NUM_ELEMENTS / 2) {
+        failed = true;
+    }
+    if(!presentationQueue_compareIterative(&ring, &copy) || !presentationQueue_empty(ring) || !presentationQueue_empty(copy)) {
+        failed = true;
+    }
+    
+    // Queues with a different number of presentations are different
+    presentationQueue_duplicate(&ring, list);
+    presentationQueue_duplicate(&copy, list);
+    presentationQueue_dequeue(&copy);
+    if(presentationQueue_compareIterative(&ring, &copy) || presentationQueue_empty(ring)) {
+        failed = true;
+    }
+    presentationQueue_free(&ring);
+    presentationQueue_free(&copy);
+    
+    // A queue too long for the recursive algorithms
+    for(i=PERF_NUM_ELEMENTS; i<100 * PERF_NUM_ELEMENTS; i++) {
+        presentation_init(&presentation, i % 2 == 0 ? &org : &other, i % 7, "title", "topic");
+        presentationQueue_enqueue(&list, presentation);
+    }
+    score = 0;
+    for(i=0; i<100 * PERF_NUM_ELEMENTS; i+=2) {
+        score += i % 7;
+    }
+    if(presentationQueue_getOrganizationScoreIterative(&list, &org) != score) {
+        failed = true;
+    }
+    presentationQueue_createQueue(&copy);
+    if(presentationQueue_getOrganizationPresentationsIterative(&list, &org, &copy) != OK || presentationQueue_head(copy) == NULL) {
+        failed = true;
+    }
+    i = 0;
+    for(presentationQueue_begin(&copy, &it); presentationQueue_get(&it) != NULL; presentationQueue_next(&it)) {
+        i++;
+    }
+    if(i != 50 * PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    presentationQueue_free(&copy);
+    presentationQueue_free(&list);
+    organization_free(&other);
+    
+    if(failed) {
+        end_test(test_section, "PERF_QUEUES_5", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_QUEUES_5", true);
+    }
+    
+    // Remove used data
+    organization_free(&org);
+    guestTable_free(&guests);
+    
+    return passed;
+}
+
+// Run tests for the queries of a congress
+bool run_perf_congress(tTestSection* test_section) {
+    bool passed = true, failed = false;
+    tGuestTable guests;
+    tOrganization org;
+    tCongress congress, ring, copy;
+    tWal wal;
+    tPresentationQueue presentations;
+    tPresentationView view;
+    tPresentationData* rows;
+    tGuestTable guests1, guests2, all;
+    tGuest guest;
+    tError* errors;
+    tPresentationQueueNode* pNode;
+    tPresentationQueueIterator it;
+    tRankingTopicIterator topicIt, otherTopicIt;
+    tPresentation* pAux;
+    double organizationBest, othersBest;
+    double total, minimum, maximum;
+    unsigned int count;
+    tScoreStats stats;
+    FILE* file;
+    tImportStats importStats;
+    int expected;
+    char name[32], topic[32];
+    char text[1024];
+    int i;
+    
+    guestTable_init(&guests);
+    
+    // Create a congress with many presentations on a few topics. Each organization has its best score on the topic with its same number.
+    congress_init(&congress, "congress");
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i);
+        organization_init(&org, name, &guests);
+        congress_registerOrganization(&congress, &org);
+        organization_free(&org);
+    }
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "org%d", i % PERF_NUM_GROUPS);
+        sprintf(topic, "topic%d", (i / PERF_NUM_GROUPS) % PERF_NUM_GROUPS);
+        congress_addPresentation(&congress, name, (i / PERF_NUM_GROUPS) % PERF_NUM_GROUPS == i % PERF_NUM_GROUPS ? 10.0 : 1.0, "title", topic);
+    }
+    
+    // TEST 1: Intern the topics and organization names
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_1", "Intern the topics and organization names");
+    
+    // All the presentations share the same copy of each topic, and the name of their registered organization
+    pNode = congress.presentations.first;
+    while(pNode != NULL) {
+        if(pNode->e.topicId == INTERN_NO_ID || pNode->e.organizationId == INTERN_NO_ID) {
+            failed = true;
+        } else if(pNode->e.presentationTopic != internTable_get(&congress.names, pNode->e.topicId)
+            || pNode->e.organization.name != congress_findOrganization(&congress, internTable_get(&congress.names, pNode->e.organizationId))->name) {
+            failed = true;
+        }
+        pNode = pNode->next;
+    }
+    if(congress.names.size != 2 * PERF_NUM_GROUPS || internTable_find(&congress.names, "topic0") != congress.presentations.first->e.topicId) {
+        failed = true;
+    }
+    
+    // The copies of the presentations take a reference to the same name
+    presentationQueue_createQueue(&presentations);
+    if(congress_getOrganizationPresentations(&congress, "org1", &presentations) != OK || presentationQueue_empty(presentations)
+        || presentationQueue_head(presentations)->organization.name != congress_findOrganization(&congress, "org1")->name
+        || *(congress_findOrganization(&congress, "org1")->references) != 1 + 2 * PERF_NUM_ELEMENTS / PERF_NUM_GROUPS) {
+        failed = true;
+    }
+    presentationQueue_free(&presentations);
+    if(*(congress_findOrganization(&congress, "org1")->references) != 1 + PERF_NUM_ELEMENTS / PERF_NUM_GROUPS) {
+        failed = true;
+    }
+    
+    // Each organization only wins on its topic
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i);
+        sprintf(topic, "topic%d", i);
+        if(congress_getOrganizationWins(&congress, name, topic) != 3) {
+            failed = true;
+        }
+        sprintf(topic, "topic%d", (i + 1) % PERF_NUM_GROUPS);
+        if(congress_getOrganizationWins(&congress, name, topic) != 0) {
+            failed = true;
+        }
+    }
+    if(congress_getOrganizationWins(&congress, "org0", "org1") != ERR_NOT_EXISTS) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_1", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_1", true);
+    }
+    
+    // TEST 2: Get the wins from the ranking of the topics
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_2", "Get the wins from the ranking of the topics");
+    
+    // Add presentations with repeated scores, so there are draws and the best organization of the topics changes
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "org%d", (i * 7) % PERF_NUM_GROUPS);
+        sprintf(topic, "topic%d", (i * 3) % PERF_NUM_GROUPS);
+        congress_addPresentation(&congress, name, (i * 13) % 17, "title", topic);
+    }
+    
+    // The wins must be the same as comparing the best scores of all the presentations
+    for(i=0; i<PERF_NUM_GROUPS * PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i % PERF_NUM_GROUPS);
+        sprintf(topic, "topic%d", i / PERF_NUM_GROUPS);
+        organizationBest = -1;
+        othersBest = -1;
+        for(presentationQueue_begin(&congress.presentations, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+            if(strcmp(pAux->presentationTopic, topic) == 0) {
+                if(strcmp(pAux->organization.name, name) == 0) {
+                    organizationBest = pAux->score > organizationBest ? pAux->score : organizationBest;
+                } else {
+                    othersBest = pAux->score > othersBest ? pAux->score : othersBest;
+                }
+            }
+        }
+        expected = organizationBest > othersBest ? 3 : (organizationBest == othersBest ? 1 : 0);
+        if(congress_getOrganizationWins(&congress, name, topic) != expected) {
+            failed = true;
+        }
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_2", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_2", true);
+    }
+    
+    // TEST 3: Get the scores from the aggregates of the organizations
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_3", "Get the scores from the aggregates of the organizations");
+    
+    // The aggregates must be the same as walking all the presentations
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i);
+        count = 0;
+        total = 0;
+        minimum = 0;
+        maximum = 0;
+        for(presentationQueue_begin(&congress.presentations, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+            if(strcmp(pAux->organization.name, name) == 0) {
+                minimum = (count == 0 || pAux->score < minimum) ? pAux->score : minimum;
+                maximum = (count == 0 || pAux->score > maximum) ? pAux->score : maximum;
+                total += pAux->score;
+                count++;
+            }
+        }
+        if(congress_getOrganizationStats(&congress, name, &stats) != OK) {
+            failed = true;
+        } else if(stats.count != count || stats.sum != total || stats.min != minimum || stats.max != maximum) {
+            failed = true;
+        }
+        if(congress_getOrganizationScore(&congress, name) != total || congress_getOrganizationAverage(&congress, name) != total / count) {
+            failed = true;
+        }
+    }
+    
+    // Organizations without presentations have empty aggregates, and unknown organizations are an error
+    organization_init(&org, "empty", &guests);
+    congress_registerOrganization(&congress, &org);
+    organization_free(&org);
+    if(congress_getOrganizationStats(&congress, "empty", &stats) != OK || stats.count != 0 || congress_getOrganizationAverage(&congress, "empty") != 0) {
+        failed = true;
+    }
+    if(congress_getOrganizationStats(&congress, "none", &stats) != ERR_NOT_EXISTS || congress_getOrganizationScore(&congress, "none") != 0) {
+        failed = true;
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_3", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_3", true);
+    }
+    
+    // TEST 4: Get the presentations of the organizations from the index
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_4", "Get the presentations of the organizations from the index");
+    
+    // The views point to the presentations of the queue, in the same order
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i);
+        if(congress_getOrganizationPresentationsView(&congress, name, &view) != OK) {
+            failed = true;
+            continue;
+        }
+        count = 0;
+        for(presentationQueue_begin(&congress.presentations, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+            if(strcmp(pAux->organization.name, name) == 0) {
+                if(count >= presentationView_size(view) || presentationView_get(view, count) != pAux) {
+                    failed = true;
+                }
+                count++;
+            }
+        }
+        if(count != presentationView_size(view)) {
+            failed = true;
+        }
+    }
+    if(congress_getOrganizationPresentationsView(&congress, "empty", &view) != OK || presentationView_size(view) != 0) {
+        failed = true;
+    }
+    if(congress_getOrganizationPresentationsView(&congress, "none", &view) != ERR_INVALID_ORGANIZATION) {
+        failed = true;
+    }
+    
+    // The copies of the presentations are the same as the ones of the view
+    presentationQueue_createQueue(&presentations);
+    congress_getOrganizationPresentationsView(&congress, "org1", &view);
+    if(congress_getOrganizationPresentations(&congress, "org1", &presentations) != OK) {
+        failed = true;
+    }
+    count = 0;
+    for(presentationQueue_begin(&presentations, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        if(count >= presentationView_size(view) || !presentation_compare(*pAux, *presentationView_get(view, count))) {
+            failed = true;
+        }
+        count++;
+    }
+    if(count != presentationView_size(view)) {
+        failed = true;
+    }
+    presentationQueue_free(&presentations);
+    
+    // The index follows the presentations when a ring queue moves them to a larger array
+    congress_initQueueType(&ring, "ring", PRESENTATION_QUEUE_RING);
+    organization_init(&org, "org", &guests);
+    congress_registerOrganization(&ring, &org);
+    organization_free(&org);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        congress_addPresentation(&ring, "org", i, "title", "topic");
+    }
+    if(congress_getOrganizationPresentationsView(&ring, "org", &view) != OK || presentationView_size(view) != PERF_NUM_ELEMENTS) {
+        failed = true;
+    } else {
+        for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+            if(presentationView_get(view, i)->score != i) {
+                failed = true;
+            }
+        }
+        if(presentationView_get(view, 0) != presentationQueue_head(ring.presentations)) {
+            failed = true;
+        }
+    }
+    congress_free(&ring);
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_4", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_4", true);
+    }
+    
+    // TEST 5: Add the presentations of a congress in a batch
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_5", "Add the presentations of a congress in a batch");
+    
+    // The batch has all the presentations of the congress, and one of an unknown organization
+    count = 0;
+    for(presentationQueue_begin(&congress.presentations, &it); presentationQueue_get(&it) != NULL; presentationQueue_next(&it)) {
+        count++;
+    }
+    rows = (tPresentationData*) malloc((count + 1) * sizeof(tPresentationData));
+    errors = (tError*) malloc((count + 1) * sizeof(tError));
+    i = 0;
+    for(presentationQueue_begin(&congress.presentations, &it); (pAux = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        if(i == count / 2) {
+            rows[i].organizationName = "none";
+            rows[i].score = 100.0;
+            rows[i].title = "title";
+            rows[i].topic = "topic0";
+            i++;
+        }
+        rows[i].organizationName = pAux->organization.name;
+        rows[i].score = pAux->score;
+        rows[i].title = pAux->presentationTitle;
+        rows[i].topic = pAux->presentationTopic;
+        i++;
+    }
+    
+    // Load the batch on a ring queue, which is allocated once
+    congress_initQueueType(&ring, "ring", PRESENTATION_QUEUE_RING);
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i);
+        organization_init(&org, name, &guests);
+        congress_registerOrganization(&ring, &org);
+        organization_free(&org);
+    }
+    if(congress_addPresentationsBatch(&ring, rows, count + 1, errors) != count || ring.presentations.count != count || ring.presentations.capacity < count || ring.presentations.capacity >= 2 * count) {
+        failed = true;
+    }
+    for(i=0; i<count + 1; i++) {
+        if(errors[i] != (i == count / 2 ? ERR_INVALID_ORGANIZATION : OK)) {
+            failed = true;
+        }
+    }
+    
+    // The queries give the same results as adding the presentations one by one
+    for(i=0; i<PERF_NUM_GROUPS * PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i % PERF_NUM_GROUPS);
+        sprintf(topic, "topic%d", i / PERF_NUM_GROUPS);
+        if(congress_getOrganizationWins(&ring, name, topic) != congress_getOrganizationWins(&congress, name, topic)) {
+            failed = true;
+        }
+    }
+    for(i=0; i<PERF_NUM_GROUPS; i++) {
+        sprintf(name, "org%d", i);
+        congress_getOrganizationStats(&congress, name, &stats);
+        congress_getOrganizationPresentationsView(&ring, name, &view);
+        if(congress_getOrganizationScore(&ring, name) != stats.sum || presentationView_size(view) != stats.count) {
+            failed = true;
+        }
+    }
+    congress_free(&ring);
+    free(rows);
+    free(errors);
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_5", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_5", true);
+    }
+    
+    // TEST 6: Get the guests of organizations sharing their tables
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_6", "Get the guests of organizations sharing their tables");
+    
+    // Two tables of guests with half of the guests in common, each one shared by half of the organizations
+    guestTable_init(&guests1);
+    guestTable_init(&guests2);
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "guest%d", i);
+        guest_init(&guest, name, "name", "guest@uoc.edu");
+        guestTable_add(i % 2 == 0 ? &guests1 : &guests2, &guest);
+        guest_free(&guest);
+        sprintf(name, "guest%d", PERF_NUM_ELEMENTS + i);
+        guest_init(&guest, name, "name", "guest@uoc.edu");
+        guestTable_add(&guests1, &guest);
+        guestTable_add(&guests2, &guest);
+        guest_free(&guest);
+    }
+    congress_init(&ring, "guests");
+    for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "org%d", i);
+        organization_init(&org, name, i % 2 == 0 ? &guests1 : &guests2);
+        congress_registerOrganization(&ring, &org);
+        organization_free(&org);
+    }
+    
+    // Each guest is on the result once, and the result is allocated once for the guests of both tables
+    guestTable_init(&all);
+    if(congress_getGuests(&ring, &all) != OK || guestTable_size(&all) != 2 * PERF_NUM_ELEMENTS || all.capacity != 3 * PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    for(i=0; i<2 * PERF_NUM_ELEMENTS; i++) {
+        sprintf(name, "guest%d", i);
+        if(guestTable_find(&all, name) == NULL) {
+            failed = true;
+        }
+    }
+    
+    // The guests already on the result are skipped
+    if(congress_getGuests(&ring, &all) != OK || guestTable_size(&all) != 2 * PERF_NUM_ELEMENTS) {
+        failed = true;
+    }
+    
+    guestTable_free(&all);
+    congress_free(&ring);
+    guestTable_free(&guests1);
+    guestTable_free(&guests2);
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_6", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_6", true);
+    }
+    
+    // TEST 7: Save a congress to a snapshot and load it again
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_7", "Save a congress to a snapshot and load it again");
+    
+    // The shared table of guests is saved with its guests
+    for(i=0; i<3; i++) {
+        sprintf(name, "snapshot%d", i);
+        guest_init(&guest, name, "name", "snapshot@uoc.edu");
+        guestTable_add(&guests, &guest);
+        guest_free(&guest);
+    }
+    if(congress_save(&congress, "perf_congress.snapshot") != OK || congress_load(&ring, "perf_congress.snapshot") != OK) {
+        failed = true;
+    } else {
+        // The loaded congress gives the same results, and its organizations share one table of guests
+        if(strcmp(ring.name, congress.name) != 0 || ring.presentations.type != congress.presentations.type || ring.guestTablesCount != 1 || ring.guestTables[0]->size != 3 || !guestTable_equals(ring.guestTables[0], &guests)) {
+            failed = true;
+        }
+        for(i=0; i<PERF_NUM_GROUPS * PERF_NUM_GROUPS; i++) {
+            sprintf(name, "org%d", i % PERF_NUM_GROUPS);
+            sprintf(topic, "topic%d", i / PERF_NUM_GROUPS);
+            if(congress_getOrganizationWins(&ring, name, topic) != congress_getOrganizationWins(&congress, name, topic)) {
+                failed = true;
+            }
+        }
+        for(i=0; i<PERF_NUM_GROUPS; i++) {
+            sprintf(name, "org%d", i);
+            congress_getOrganizationStats(&congress, name, &stats);
+            congress_getOrganizationPresentationsView(&ring, name, &view);
+            if(congress_getOrganizationScore(&ring, name) != stats.sum || presentationView_size(view) != stats.count
+                || organizationTable_find(ring.organizations, name)->guests != ring.guestTables[0]) {
+                failed = true;
+            }
+            // The names and titles are the strings loaded on the arena, which are not copied again for each organization and presentation
+            if(organizationTable_find(ring.organizations, name)->references != NULL || presentationView_size(view) < 2
+                || presentationView_get(view, 0)->organization.name != organizationTable_find(ring.organizations, name)->name
+                || presentationView_get(view, 0)->presentationTitle != presentationView_get(view, 1)->presentationTitle) {
+                failed = true;
+            }
+        }
+        
+        // The loaded guests can be removed, although their fields belong to the congress
+        guest = ring.guestTables[0]->elements[0];
+        if(guestTable_remove(ring.guestTables[0], &guest) != OK || guestTable_find(ring.guestTables[0], guest.username) != NULL) {
+            failed = true;
+        }
+        guest = ring.guestTables[0]->elements[0];
+        if(guestTable_removeUnordered(ring.guestTables[0], &guest) != OK || ring.guestTables[0]->size != guests.size - 2) {
+            failed = true;
+        }
+        congress_free(&ring);
+    }
+    
+    // Missing and damaged files are rejected
+    if(congress_load(&ring, "perf_missing.snapshot") != ERR_CANNOT_READ) {
+        failed = true;
+    }
+    file = fopen("perf_congress.snapshot", "r+b");
+    if(file == NULL) {
+        failed = true;
+    } else {
+        fputs("XXXX", file);
+        fclose(file);
+        if(congress_load(&ring, "perf_congress.snapshot") != ERR_INVALID) {
+            failed = true;
+        }
+    }
+    remove("perf_congress.snapshot");
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_7", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_7", true);
+    }
+    
+    // TEST 8: Import a congress from CSV and JSON lines files
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_8", "Import a congress from CSV and JSON lines files");
+    
+    // The guests take more than one read buffer. Invalid rows, repeated guests and lines longer than the buffer are rejected.
+    file = fopen("perf_import.csv", "w+b");
+    if(file == NULL) {
+        failed = true;
+    } else {
+        fputs("# guests\n\n", file);
+        for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+            fprintf(file, "guest,guest%d,name,guest%d@uoc.edu\n", i, i);
+        }
+        fputs("guest,guest0,name,guest0@uoc.edu\nunknown,row\n", file);
+        for(i=0; i<IMPORTER_BUFFER_SIZE; i++) {
+            fputc('x', file);
+        }
+        fputs("\norganization,\"org,1\"\r\norganization,org2\n", file);
+        fputs("presentation,\"org,1\",7.5,\"say \"\"hi\"\"\",topic\r\npresentation,org2,abc,title,topic\npresentation,none,1,title,topic\npresentation,org2,3,title,topic", file);
+        rewind(file);
+        guestTable_init(&all);
+        congress_init(&ring, "import");
+        if(congress_import(&ring, &all, file, IMPORT_CSV, &importStats) != OK || importStats.rows != PERF_NUM_ELEMENTS + 4 || importStats.rejected != 5) {
+            failed = true;
+        }
+        fclose(file);
+        remove("perf_import.csv");
+        if(guestTable_size(&all) != PERF_NUM_ELEMENTS || guestTable_find(&all, "guest1999") == NULL || ring.organizations->size != 2) {
+            failed = true;
+        }
+        if(congress_getOrganizationPresentationsView(&ring, "org,1", &view) != OK || presentationView_size(view) != 1
+            || strcmp(presentationView_get(view, 0)->presentationTitle, "say \"hi\"") != 0 || congress_getOrganizationScore(&ring, "org2") != 3) {
+            failed = true;
+        }
+        congress_free(&ring);
+        guestTable_free(&all);
+    }
+    
+    // JSON lines rows, with escaped strings and fields on any order
+    file = fopen("perf_import.jsonl", "w+b");
+    if(file == NULL) {
+        failed = true;
+    } else {
+        fputs("{\"type\":\"guest\",\"username\":\"jos\\u00e9\",\"name\":\"Jos\\u00e9 \\\"Pep\\\"\",\"mail\":\"jose@uoc.edu\"}\n", file);
+        fputs("{ \"name\" : \"org\\/1\", \"type\" : \"organization\" }\n", file);
+        fputs("{\"type\":\"presentation\",\"organization\":\"org/1\",\"score\":2e1,\"title\":\"title\",\"topic\":\"topic\"}\n", file);
+        fputs("{\"type\":\"presentation\",\"organization\":\"org/1\",\"score\":\"1\",\"title\":\"title\",\"topic\":\"topic\"}\n", file);
+        fputs("{\"type\":\"guest\",\"username\":\"unterminated}\n", file);
+        rewind(file);
+        guestTable_init(&all);
+        congress_init(&ring, "import");
+        if(congress_import(&ring, &all, file, IMPORT_JSON_LINES, &importStats) != OK || importStats.rows != 3 || importStats.rejected != 2) {
+            failed = true;
+        }
+        fclose(file);
+        remove("perf_import.jsonl");
+        if(guestTable_find(&all, "jos\xc3\xa9") == NULL || strcmp(guestTable_find(&all, "jos\xc3\xa9")->name, "Jos\xc3\xa9 \"Pep\"") != 0 || congress_getOrganizationScore(&ring, "org/1") != 20) {
+            failed = true;
+        }
+        congress_free(&ring);
+        guestTable_free(&all);
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_8", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_8", true);
+    }
+    
+    // TEST 9: Export a congress as JSON
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_9", "Export a congress as JSON");
+    
+    // A small congress is written exactly, escaping its strings
+    guestTable_init(&all);
+    guest_init(&guest, "u1", "Name\n", "u1@uoc.edu");
+    guestTable_add(&all, &guest);
+    guest_free(&guest);
+    congress_init(&ring, "c\"1");
+    organization_init(&org, "o1", &all);
+    congress_registerOrganization(&ring, &org);
+    organization_free(&org);
+    organization_init(&org, "o2", &all);
+    congress_registerOrganization(&ring, &org);
+    organization_free(&org);
+    congress_addPresentation(&ring, "o1", 7.5, "t\\1", "topic");
+    congress_addPresentation(&ring, "o1", 2, "t2", "topic2");
+    file = fopen("perf_export.json", "w+b");
+    if(file == NULL) {
+        failed = true;
+    } else {
+        if(congress_export(&ring, file) != OK) {
+            failed = true;
+        }
+        rewind(file);
+        memset(text, 0, sizeof(text));
+        fread(text, 1, sizeof(text) - 1, file);
+        fclose(file);
+        if(strcmp(text, "{\"name\":\"c\\\"1\",\"organizations\":[\n"
+            "{\"name\":\"o1\",\"guests\":[{\"username\":\"u1\",\"name\":\"Name\\n\",\"mail\":\"u1@uoc.edu\"}],\"presentations\":2,\"score\":9.5,\"average\":4.75,\"wins\":{\"topic\":3,\"topic2\":3}},\n"
+            "{\"name\":\"o2\",\"guests\":[{\"username\":\"u1\",\"name\":\"Name\\n\",\"mail\":\"u1@uoc.edu\"}],\"presentations\":0,\"score\":0,\"average\":0,\"wins\":{}}],\"presentations\":[\n"
+            "{\"organization\":\"o1\",\"title\":\"t\\\\1\",\"topic\":\"topic\",\"score\":7.5},\n"
+            "{\"organization\":\"o1\",\"title\":\"t2\",\"topic\":\"topic2\",\"score\":2}]}\n") != 0) {
+            failed = true;
+        }
+    }
+    
+    // The wins are taken from the topics of each organization, in the order of their first presentation
+    congress_addPresentation(&ring, "o1", 1, "t3", "topic");
+    ranking_beginTopics(&ring.ranking, internTable_find(&ring.names, "o1"), &topicIt);
+    if(ranking_getTopic(&topicIt) != internTable_find(&ring.names, "topic")) {
+        failed = true;
+    }
+    ranking_nextTopic(&topicIt);
+    if(ranking_getTopic(&topicIt) != internTable_find(&ring.names, "topic2")) {
+        failed = true;
+    }
+    ranking_nextTopic(&topicIt);
+    ranking_beginTopics(&ring.ranking, internTable_find(&ring.names, "o2"), &otherTopicIt);
+    if(ranking_getTopic(&topicIt) != 0 || ranking_getTopic(&otherTopicIt) != 0) {
+        failed = true;
+    }
+    congress_free(&ring);
+    guestTable_free(&all);
+    
+    // A large congress takes many blocks, with one line for each organization and presentation
+    count = 0;
+    for(presentationQueue_begin(&congress.presentations, &it); presentationQueue_get(&it) != NULL; presentationQueue_next(&it)) {
+        count++;
+    }
+    file = fopen("perf_export.json", "w+b");
+    if(file == NULL) {
+        failed = true;
+    } else {
+        if(congress_export(&congress, file) != OK || ftell(file) <= EXPORTER_BUFFER_SIZE) {
+            failed = true;
+        }
+        rewind(file);
+        expected = 0;
+        while((i = fgetc(file)) != EOF) {
+            if(i == '\n') {
+                expected++;
+            }
+        }
+        fclose(file);
+        if(expected != congress.organizations->size + count + 1) {
+            failed = true;
+        }
+    }
+    remove("perf_export.json");
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_9", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_9", true);
+    }
+    
+    // TEST 10: Log the changes of a congress and replay them
+    failed = false;
+    start_test(test_section, "PERF_CONGRESS_10", "Log the changes of a congress and replay them");
+    
+    // The changes are synced once for each group of records. Rejected changes are not logged. Each table of guests is logged once, with the first organization that uses it.
+    remove("perf_congress.wal");
+    guestTable_init(&all);
+    guestTable_init(&guests1);
+    for(i=0; i<3; i++) {
+        sprintf(name, "wal%d", i);
+        guest_init(&guest, name, "name", "wal@uoc.edu");
+        guestTable_add((i == 0) ? &guests1 : &all, &guest);
+        guest_free(&guest);
+    }
+    congress_init(&ring, "wal");
+    if(wal_open(&wal, "perf_congress.wal", 64, &ring) != OK || wal.replayed != 0) {
+        failed = true;
+    } else {
+        for(i=0; i<PERF_NUM_GROUPS; i++) {
+            sprintf(name, "org%d", i);
+            organization_init(&org, name, (i % 2 == 0) ? &all : &guests1);
+            congress_registerOrganizationLogged(&ring, &wal, &org);
+            organization_free(&org);
+        }
+        for(i=0; i<PERF_NUM_ELEMENTS; i++) {
+            sprintf(name, "org%d", i % PERF_NUM_GROUPS);
+            sprintf(topic, "topic%d", i % 7);
+            congress_addPresentationLogged(&ring, &wal, name, i % 10, "title", topic);
+        }
+        if(congress_addPresentationLogged(&ring, &wal, "none", 1, "title", "topic0") == OK) {
+            failed = true;
+        }
+        organization_init(&org, "org0", &all);
+        if(congress_removeOrganizationLogged(&ring, &wal, &org) != OK || congress_removeOrganizationLogged(&ring, &wal, &org) != ERR_NOT_FOUND) {
+            failed = true;
+        }
+        organization_free(&org);
+        
+        // A change that cannot be logged is not applied
+        wal.failed = true;
+        total = congress_getOrganizationScore(&ring, "org1");
+        organization_init(&org, "unlogged", &guests);
+        if(congress_registerOrganizationLogged(&ring, &wal, &org) != ERR_CANNOT_WRITE || congress_findOrganization(&ring, "unlogged") != NULL || wal.lastTable != 2
+            || congress_addPresentationLogged(&ring, &wal, "org1", 10, "title", "topic1") != ERR_CANNOT_WRITE || congress_getOrganizationScore(&ring, "org1") != total) {
+            failed = true;
+        }
+        organization_free(&org);
+        wal.failed = false;
+        count = PERF_NUM_GROUPS + PERF_NUM_ELEMENTS + 1 + 4;
+        if(wal.commits != count / 64 || wal_close(&wal) != OK) {
+            failed = true;
+        }
+    }
+    
+    // The replay gives the same congress, with the organizations sharing the tables of guests restored by the congress
+    congress_init(&copy, "wal");
+    if(wal_open(&wal, "perf_congress.wal", 64, &copy) != OK || wal.replayed != count || wal.commits != 0) {
+        failed = true;
+    } else {
+        if(copy.organizations->size != PERF_NUM_GROUPS - 1 || copy.organizationIndex.count != copy.organizations->size || congress_findOrganization(&copy, "org0") != NULL || copy.guestTablesCount != 2
+            || congress_findOrganization(&copy, "org2")->guests != congress_findOrganization(&copy, "org4")->guests) {
+            failed = true;
+        }
+        for(i=1; i<PERF_NUM_GROUPS; i++) {
+            sprintf(name, "org%d", i);
+            sprintf(topic, "topic%d", i % 7);
+            if(congress_getOrganizationScore(&copy, name) != congress_getOrganizationScore(&ring, name)
+                || congress_getOrganizationWins(&copy, name, topic) != congress_getOrganizationWins(&ring, name, topic)
+                || !organization_equals(congress_findOrganization(&copy, name), congress_findOrganization(&ring, name))) {
+                failed = true;
+            }
+        }
+        guestTable_init(&guests2);
+        if(congress_getGuests(&copy, &guests2) != OK || guests2.size != 3) {
+            failed = true;
+        }
+        guestTable_free(&guests2);
+        
+        // The replayed guests can be removed, although their fields belong to the congress
+        guest = congress_findOrganization(&copy, "org2")->guests->elements[0];
+        if(guestTable_removeUnordered(congress_findOrganization(&copy, "org2")->guests, &guest) != OK
+            || guestTable_find(congress_findOrganization(&copy, "org4")->guests, guest.username) != NULL) {
+            failed = true;
+        }
+        guest = congress_findOrganization(&copy, "org2")->guests->elements[0];
+        if(guestTable_remove(congress_findOrganization(&copy, "org2")->guests, &guest) != OK || congress_findOrganization(&copy, "org4")->guests->size != 0) {
+            failed = true;
+        }
+        
+        // A restored table is not logged again
+        organization_init(&org, "restored", congress_findOrganization(&copy, "org1")->guests);
+        if(congress_registerOrganizationLogged(&copy, &wal, &org) != OK || wal.lastTable != 2) {
+            failed = true;
+        }
+        organization_free(&org);
+        organization_init(&org, "restored", &all);
+        congress_removeOrganizationLogged(&copy, &wal, &org);
+        organization_free(&org);
+        wal_close(&wal);
+        count += 2;
+    }
+    congress_free(&copy);
+    
+    // A record cut by a crash is removed, and the next records are written after the valid ones
+    file = fopen("perf_congress.wal", "ab");
+    if(file == NULL) {
+        failed = true;
+    } else {
+        fwrite("\x20\0\0\0\x03partial", 1, 12, file);
+        fclose(file);
+    }
+    congress_init(&copy, "wal");
+    if(wal_open(&wal, "perf_congress.wal", 64, &copy) != OK || wal.replayed != count
+        || congress_addPresentationLogged(&copy, &wal, "org1", 10, "title", "topic1") != OK || wal_close(&wal) != OK) {
+        failed = true;
+    }
+    congress_free(&copy);
+    congress_init(&copy, "wal");
+    if(wal_open(&wal, "perf_congress.wal", 64, &copy) != OK || wal.replayed != count + 1
+        || congress_getOrganizationScore(&copy, "org1") != congress_getOrganizationScore(&ring, "org1") + 10) {
+        failed = true;
+    } else {
+        wal_close(&wal);
+    }
+    congress_free(&copy);
+    remove("perf_congress.wal");
+    
+    congress_free(&ring);
+    guestTable_free(&all);
+    guestTable_free(&guests1);
+    
+    if(failed) {
+        end_test(test_section, "PERF_CONGRESS_10", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_CONGRESS_10", true);
+    }
+    
+    // Remove used data
+    congress_free(&congress);
+    guestTable_free(&guests);
+    
+    return passed;
+}
+
+// Run tests for the congresses shared by many threads
+bool run_perf_threads(tTestSection* test_section) {
+    bool passed = true, failed = false;
+    tSharedCongress shared;
+    tCongress congress;
+    tIngestQueue queue;
+    tPresentationView view;
+    tGuestTable guests;
+    tOrganization org;
+    tThread threads[PERF_NUM_READERS + PERF_NUM_WRITERS];
+    tPerfThreadData data[PERF_NUM_READERS + PERF_NUM_WRITERS];
+    bool started[PERF_NUM_READERS + PERF_NUM_WRITERS];
+    tScoreStats stats;
+    unsigned int total, expected;
+    char name[32];
+    int i, j;
+    
+    guestTable_init(&guests);
+    
+    // TEST 1: Query a shared congress while other threads change it
+    failed = false;
+    start_test(test_section, "PERF_THREADS_1", "Query a shared congress while other threads change it");
+    
+    if(sharedCongress_init(&shared, "shared") != OK) {
+        failed = true;
+    } else {
+        for(i=0; i<PERF_NUM_GROUPS; i++) {
+            sprintf(name, "org%d", i);
+            organization_init(&org, name, &guests);
+            sharedCongress_registerOrganization(&shared, &org);
+            organization_free(&org);
+        }
+        
+        // The readers check that each query sees a consistent state, which only grows
+        for(i=0; i<PERF_NUM_READERS + PERF_NUM_WRITERS; i++) {
+            data[i].congress = &shared;
+            data[i].queue = NULL;
+            data[i].id = i;
+            data[i].failed = false;
+            started[i] = (thread_start(&threads[i], (i < PERF_NUM_READERS) ? perf_readCongress : perf_writeCongress, &data[i]) == OK);
+            if(!started[i]) {
+                failed = true;
+            }
+        }
+        for(i=0; i<PERF_NUM_READERS + PERF_NUM_WRITERS; i++) {
+            if(started[i]) {
+                thread_join(&threads[i]);
+            }
+            if(data[i].failed) {
+                failed = true;
+            }
+        }
+        
+        // No presentation is lost
+        total = 0;
+        for(i=0; i<PERF_NUM_GROUPS; i++) {
+            sprintf(name, "org%d", i);
+            sharedCongress_getOrganizationStats(&shared, name, &stats);
+            total += stats.count;
+        }
+        if(total != PERF_NUM_WRITERS * PERF_NUM_ELEMENTS) {
+            failed = true;
+        }
+        sharedCongress_free(&shared);
+    }
+    
+    if(failed) {
+        end_test(test_section, "PERF_THREADS_1", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_THREADS_1", true);
+    }
+    
+    // TEST 2: Submit presentations from many threads to a lock free queue
+    failed = false;
+    start_test(test_section, "PERF_THREADS_2", "Submit presentations from many threads to a lock free queue");
+    
+    congress_init(&congress, "ingest");
+    for(i=0; i<PERF_NUM_READERS + PERF_NUM_WRITERS; i++) {
+        sprintf(name, "org%d", i);
+        organization_init(&org, name, &guests);
+        congress_registerOrganization(&congress, &org);
+        organization_free(&org);
+    }
+    ingestQueue_init(&queue);
+    
+    // The consumer drains the queue while the producers submit to it
+    expected = 0;
+    for(i=0; i<PERF_NUM_READERS + PERF_NUM_WRITERS; i++) {
+        data[i].congress = NULL;
+        data[i].queue = &queue;
+        data[i].id = i;
+        data[i].failed = false;
+        started[i] = (thread_start(&threads[i], perf_submitPresentations, &data[i]) == OK);
+        if(started[i]) {
+            expected += PERF_NUM_ELEMENTS;
+        } else {
+            failed = true;
+        }
+    }
+    total = 0;
+    while(total < expected) {
+        total += congress_drainIngestQueue(&congress, &queue, expected - total);
+    }
+    for(i=0; i<PERF_NUM_READERS + PERF_NUM_WRITERS; i++) {
+        if(started[i]) {
+            thread_join(&threads[i]);
+        }
+        if(data[i].failed) {
+            failed = true;
+        }
+    }
+    if(!ingestQueue_empty(&queue) || queue.added != expected || queue.rejected != 0) {
+        failed = true;
+    }
+    
+    // The presentations of each producer keep their order
+    for(i=0; i<PERF_NUM_READERS + PERF_NUM_WRITERS; i++) {
+        sprintf(name, "org%d", i);
+        if(started[i] && (congress_getOrganizationPresentationsView(&congress, name, &view) != OK || presentationView_size(view) != PERF_NUM_ELEMENTS)) {
+            failed = true;
+        } else if(started[i]) {
+            for(j=0; j<PERF_NUM_ELEMENTS; j++) {
+                if(presentationView_get(view, j)->score != j) {
+                    failed = true;
+                }
+            }
+        }
+    }
+    
+    // The presentations rejected by the congress are counted, and the queue releases the ones not taken
+    ingestQueue_push(&queue, "none", 1, "title", "topic");
+    ingestQueue_push(&queue, "org0", 1, "title", "topic");
+    ingestQueue_push(&queue, "org0", 1, "title", "topic");
+    if(congress_drainIngestQueue(&congress, &queue, 2) != 2 || queue.rejected != 1 || ingestQueue_empty(&queue)) {
+        failed = true;
+    }
+    ingestQueue_free(&queue);
+    if(!ingestQueue_empty(&queue)) {
+        failed = true;
+    }
+    congress_free(&congress);
+    
+    if(failed) {
+        end_test(test_section, "PERF_THREADS_2", false);
+        passed = false;
+    } else {
+        end_test(test_section, "PERF_THREADS_2", true);
+    }
+    
+    // Remove used data
+    guestTable_free(&guests);
+    
+    return passed;
+}
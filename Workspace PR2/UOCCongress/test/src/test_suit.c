@@ -15,5 +15,8 @@ bool run_all(tTestSuite* test_suite) {
     // Run tests for PR2
     ok = ok && run_pr2(test_suite);
     
+    // Run tests for the performance extensions
+    ok = ok && run_perf(test_suite);
+    
     return ok;
 }
\ No newline at end of file
@@ -62,7 +62,7 @@ AS       := C:/winbuilds/bin/as.exe
 ## User defined environment variables
 ##
 CodeLiteDir:=C:\Program Files\CodeLite
-Objects0=$(IntermediateDirectory)/src_organization.c$(ObjectSuffix) $(IntermediateDirectory)/src_presentation.c$(ObjectSuffix) $(IntermediateDirectory)/src_congress.c$(ObjectSuffix) $(IntermediateDirectory)/src_guest.c$(ObjectSuffix) 
+Objects0=$(IntermediateDirectory)/src_organization.c$(ObjectSuffix) $(IntermediateDirectory)/src_presentation.c$(ObjectSuffix) $(IntermediateDirectory)/src_congress.c$(ObjectSuffix) $(IntermediateDirectory)/src_guest.c$(ObjectSuffix) $(IntermediateDirectory)/src_hash.c$(ObjectSuffix) $(IntermediateDirectory)/src_arena.c$(ObjectSuffix) $(IntermediateDirectory)/src_intern.c$(ObjectSuffix) $(IntermediateDirectory)/src_ranking.c$(ObjectSuffix) $(IntermediateDirectory)/src_view.c$(ObjectSuffix) $(IntermediateDirectory)/src_snapshot.c$(ObjectSuffix) $(IntermediateDirectory)/src_importer.c$(ObjectSuffix) $(IntermediateDirectory)/src_exporter.c$(ObjectSuffix) $(IntermediateDirectory)/src_wal.c$(ObjectSuffix) $(IntermediateDirectory)/src_rwlock.c$(ObjectSuffix) $(IntermediateDirectory)/src_shared.c$(ObjectSuffix) $(IntermediateDirectory)/src_thread.c$(ObjectSuffix) $(IntermediateDirectory)/src_ingest.c$(ObjectSuffix) 
 
 
 
@@ -128,6 +128,110 @@ $(IntermediateDirectory)/src_guest.c$(PreprocessSuffix): src/guest.c
 	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_guest.c$(PreprocessSuffix) src/guest.c
 
 
+$(IntermediateDirectory)/src_hash.c$(ObjectSuffix): src/hash.c $(IntermediateDirectory)/src_hash.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/hash.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_hash.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_hash.c$(DependSuffix): src/hash.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_hash.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_hash.c$(DependSuffix) -MM src/hash.c
+
+$(IntermediateDirectory)/src_hash.c$(PreprocessSuffix): src/hash.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_hash.c$(PreprocessSuffix) src/hash.c
+
+$(IntermediateDirectory)/src_arena.c$(ObjectSuffix): src/arena.c $(IntermediateDirectory)/src_arena.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/arena.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_arena.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_arena.c$(DependSuffix): src/arena.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_arena.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_arena.c$(DependSuffix) -MM src/arena.c
+
+$(IntermediateDirectory)/src_arena.c$(PreprocessSuffix): src/arena.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_arena.c$(PreprocessSuffix) src/arena.c
+
+$(IntermediateDirectory)/src_intern.c$(ObjectSuffix): src/intern.c $(IntermediateDirectory)/src_intern.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/intern.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_intern.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_intern.c$(DependSuffix): src/intern.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_intern.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_intern.c$(DependSuffix) -MM src/intern.c
+
+$(IntermediateDirectory)/src_intern.c$(PreprocessSuffix): src/intern.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_intern.c$(PreprocessSuffix) src/intern.c
+
+$(IntermediateDirectory)/src_ranking.c$(ObjectSuffix): src/ranking.c $(IntermediateDirectory)/src_ranking.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/ranking.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_ranking.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_ranking.c$(DependSuffix): src/ranking.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_ranking.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_ranking.c$(DependSuffix) -MM src/ranking.c
+
+$(IntermediateDirectory)/src_ranking.c$(PreprocessSuffix): src/ranking.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_ranking.c$(PreprocessSuffix) src/ranking.c
+
+$(IntermediateDirectory)/src_view.c$(ObjectSuffix): src/view.c $(IntermediateDirectory)/src_view.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/view.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_view.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_view.c$(DependSuffix): src/view.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_view.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_view.c$(DependSuffix) -MM src/view.c
+
+$(IntermediateDirectory)/src_view.c$(PreprocessSuffix): src/view.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_view.c$(PreprocessSuffix) src/view.c
+
+$(IntermediateDirectory)/src_snapshot.c$(ObjectSuffix): src/snapshot.c $(IntermediateDirectory)/src_snapshot.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/snapshot.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_snapshot.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_snapshot.c$(DependSuffix): src/snapshot.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_snapshot.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_snapshot.c$(DependSuffix) -MM src/snapshot.c
+
+$(IntermediateDirectory)/src_snapshot.c$(PreprocessSuffix): src/snapshot.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_snapshot.c$(PreprocessSuffix) src/snapshot.c
+
+$(IntermediateDirectory)/src_importer.c$(ObjectSuffix): src/importer.c $(IntermediateDirectory)/src_importer.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/importer.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_importer.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_importer.c$(DependSuffix): src/importer.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_importer.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_importer.c$(DependSuffix) -MM src/importer.c
+
+$(IntermediateDirectory)/src_importer.c$(PreprocessSuffix): src/importer.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_importer.c$(PreprocessSuffix) src/importer.c
+
+$(IntermediateDirectory)/src_exporter.c$(ObjectSuffix): src/exporter.c $(IntermediateDirectory)/src_exporter.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/exporter.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_exporter.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_exporter.c$(DependSuffix): src/exporter.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_exporter.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_exporter.c$(DependSuffix) -MM src/exporter.c
+
+$(IntermediateDirectory)/src_exporter.c$(PreprocessSuffix): src/exporter.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_exporter.c$(PreprocessSuffix) src/exporter.c
+
+$(IntermediateDirectory)/src_wal.c$(ObjectSuffix): src/wal.c $(IntermediateDirectory)/src_wal.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/wal.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_wal.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_wal.c$(DependSuffix): src/wal.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_wal.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_wal.c$(DependSuffix) -MM src/wal.c
+
+$(IntermediateDirectory)/src_wal.c$(PreprocessSuffix): src/wal.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_wal.c$(PreprocessSuffix) src/wal.c
+
+$(IntermediateDirectory)/src_rwlock.c$(ObjectSuffix): src/rwlock.c $(IntermediateDirectory)/src_rwlock.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/rwlock.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_rwlock.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_rwlock.c$(DependSuffix): src/rwlock.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_rwlock.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_rwlock.c$(DependSuffix) -MM src/rwlock.c
+
+$(IntermediateDirectory)/src_rwlock.c$(PreprocessSuffix): src/rwlock.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_rwlock.c$(PreprocessSuffix) src/rwlock.c
+
+$(IntermediateDirectory)/src_shared.c$(ObjectSuffix): src/shared.c $(IntermediateDirectory)/src_shared.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/shared.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_shared.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_shared.c$(DependSuffix): src/shared.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_shared.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_shared.c$(DependSuffix) -MM src/shared.c
+
+$(IntermediateDirectory)/src_shared.c$(PreprocessSuffix): src/shared.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_shared.c$(PreprocessSuffix) src/shared.c
+
+$(IntermediateDirectory)/src_thread.c$(ObjectSuffix): src/thread.c $(IntermediateDirectory)/src_thread.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/thread.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_thread.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_thread.c$(DependSuffix): src/thread.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_thread.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_thread.c$(DependSuffix) -MM src/thread.c
+
+$(IntermediateDirectory)/src_thread.c$(PreprocessSuffix): src/thread.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_thread.c$(PreprocessSuffix) src/thread.c
+
+$(IntermediateDirectory)/src_ingest.c$(ObjectSuffix): src/ingest.c $(IntermediateDirectory)/src_ingest.c$(DependSuffix)
+	$(CC) $(SourceSwitch) "C:/Users/krono/Dropbox/MiUOC/2do.SemestreUOC/PracticasDeProgramacion/WorkspacePRs/UOCCongress2019/UOCOrganization/src/ingest.c" $(CFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_ingest.c$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_ingest.c$(DependSuffix): src/ingest.c
+	@$(CC) $(CFLAGS) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_ingest.c$(ObjectSuffix) -MF$(IntermediateDirectory)/src_ingest.c$(DependSuffix) -MM src/ingest.c
+
+$(IntermediateDirectory)/src_ingest.c$(PreprocessSuffix): src/ingest.c
+	$(CC) $(CFLAGS) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_ingest.c$(PreprocessSuffix) src/ingest.c
+
 -include $(IntermediateDirectory)/*$(DependSuffix)
 ##
 ## Clean
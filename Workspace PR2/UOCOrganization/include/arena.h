@@ -0,0 +1,36 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+#include "error.h"
+
+// Size of the blocks of memory requested by an arena. Larger allocations get a block of their own.
+#define ARENA_BLOCK_SIZE 65536
+
+// Block of memory of an arena
+typedef struct _tArenaBlock {
+    struct _tArenaBlock* next;
+    size_t size;
+    size_t used;
+    char data[];
+} tArenaBlock;
+
+// Bump allocator. The memory is taken consecutively from large blocks and it is only released all at once.
+typedef struct {
+    // List of blocks. The first one is the block used for new allocations. NULL while nothing is allocated.
+    tArenaBlock* blocks;
+} tArena;
+
+// Initialize the arena
+void arena_init(tArena* arena);
+
+// Remove all the memory of the arena, including all the values allocated from it
+void arena_free(tArena* arena);
+
+// Allocate size bytes from the arena. Returns NULL if there is no memory.
+void* arena_alloc(tArena* arena, size_t size);
+
+// Make a copy of a string on the arena. Returns NULL if there is no memory.
+char* arena_strdup(tArena* arena, const char* str);
+
+#endif // __ARENA_H__
@@ -4,42 +4,94 @@
 #include "guest.h"
 #include "organization.h"
 #include "presentation.h"
+#include "ranking.h"
+#include "view.h"
+
+// Data of a presentation added to a congress by congress_addPresentationsBatch
+typedef struct {
+    const char* organizationName;
+    double score;
+    const char* title;
+    const char* topic;
+} tPresentationData;
 
 // Definition of a congress
 typedef struct {
 	char* name;
     tOrganizationTable* organizations;
+    // Hash index over the names of the registered organizations, by their position on the table, and identifier of each name on the intern table, by the same position
+    tHashIndex organizationIndex;
+    unsigned int* organizationIds;
+    unsigned int organizationIdsCapacity;
     tPresentationQueue presentations;
+    // Memory for the strings of the organizations and presentations of the congress. It is released all at once by congress_free.
+    tArena strings;
+    // Canonical copies of the topics and organization names of the presentations, stored on the arena of the congress
+    tInternTable names;
+    // Nodes of the presentations queue
+    tPresentationNodePool nodes;
+    // Best scores of the presentations on each topic, and the score aggregates of each organization
+    tRanking ranking;
+    // Tables of guests owned by the congress, used by the organizations loaded from a snapshot or a log. Each table is allocated on its own, so their addresses do not change. NULL if there are none.
+    tGuestTable** guestTables;
+    unsigned int guestTablesCount;
+    unsigned int guestTablesCapacity;
+    // Presentations of each organization, pointing to the presentations queue
+    tPresentationIndex byOrganization;
 } tCongress;
 
 // Initialize the congress
 void congress_init(tCongress* object, char* name);
 
+// Initialize the congress, storing the presentations on the given type of queue
+void congress_initQueueType(tCongress* object, char* name, tPresentationQueueType queueType);
+
 // Remove all data for a congress
 void congress_free(tCongress* object);
 
 // Register a new organization to the congress
 tError congress_registerOrganization(tCongress* object, tOrganization* organization);
 
+// Register a new organization to the congress, sharing its name instead of copying it. The name must be kept on the arena of the congress, as the names loaded from a snapshot.
+tError congress_registerOrganizationShared(tCongress* object, tOrganization* organization);
+
 // Remove an organization from the congress
 tError congress_removeOrganization(tCongress* object, tOrganization* organization);
 
 // Find an organization
 tOrganization* congress_findOrganization(tCongress* object, const char* organizationName);
 
-// Get guests all gests of a congress
+// Add an empty table of guests owned by the congress, which is released by congress_free. Returns NULL if there is no memory.
+tGuestTable* congress_addGuestTable(tCongress* object);
+
+// Get guests all gests of a congress. The guests shared by several organizations are added once.
 tError congress_getGuests(tCongress* object, tGuestTable* guests);
 
 // Add a new presentation
 tError congress_addPresentation(tCongress* object, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic);
 
+// Add many presentations at once. The result of each one is stored on errors, if it is not NULL. Returns the number of presentations added.
+unsigned int congress_addPresentationsBatch(tCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors);
+
+// Add many presentations at once, as congress_addPresentationsBatch, without copying their strings. The titles and topics must be on the arena of the congress.
+unsigned int congress_addPresentationsBatchShared(tCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors);
+
 // Get if an organization wins on a topic. Wins means best score on a topic
 int congress_getOrganizationWins(tCongress* object, const char* organization_name, const char* topic);
 
-// Get the average score for an organization
+// Get the total score for an organization
 double congress_getOrganizationScore(tCongress* object, const char* organization_name);
 
+// Get the average score for an organization. It is 0 if the organization has no presentations.
+double congress_getOrganizationAverage(tCongress* object, const char* organization_name);
+
+// Get the number, total, minimum and maximum of the scores of an organization
+tError congress_getOrganizationStats(tCongress* object, const char* organization_name, tScoreStats* stats);
+
 // Get a queue with all the presentations for an organization
 tError congress_getOrganizationPresentations(tCongress* object, const char* organization_name, tPresentationQueue* presentations);
 
+// Get a view of all the presentations for an organization, without copying them. It is valid until a presentation is added to the congress.
+tError congress_getOrganizationPresentationsView(tCongress* object, const char* organization_name, tPresentationView* view);
+
 #endif // __CONGRESS_H__
\ No newline at end of file
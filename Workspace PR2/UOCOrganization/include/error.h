@@ -10,7 +10,9 @@ typedef enum {
     ERR_NOT_FOUND = -4,
     ERR_DUPLICATED = -5,
     ERR_INVALID_ORGANIZATION = -6,  
-    ERR_NOT_EXISTS = -7  
+    ERR_NOT_EXISTS = -7,
+    ERR_CANNOT_READ = -8,
+    ERR_CANNOT_WRITE = -9
 } tError;
 
 #endif // __ERROR_H__
\ No newline at end of file
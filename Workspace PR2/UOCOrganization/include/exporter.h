@@ -0,0 +1,16 @@
+#ifndef __EXPORTER_H__
+#define __EXPORTER_H__
+
+#include <stdio.h>
+#include "error.h"
+#include "congress.h"
+
+// Size of the buffer used to write the output. Each full buffer is written with a single call to fwrite.
+#define EXPORTER_BUFFER_SIZE 65536
+
+// Write the congress to a stream as a JSON object, with its organizations, their guests, scores and wins by topic, and its presentations:
+// {"name":"c","organizations":[{"name":"o","guests":[{"username":"u","name":"n","mail":"m"}],"presentations":1,"score":7.5,"average":7.5,"wins":{"t":3}}],"presentations":[{"organization":"o","title":"p","topic":"t","score":7.5}]}
+// The memory used does not depend on the size of the congress. Returns ERR_CANNOT_WRITE if the stream cannot be written.
+tError congress_export(tCongress* object, FILE* output);
+
+#endif // __EXPORTER_H__
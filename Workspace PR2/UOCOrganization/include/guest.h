@@ -3,6 +3,14 @@
 
 #include <stdbool.h>
 #include "error.h"
+#include "hash.h"
+#include "arena.h"
+
+// Minimum number of elements allocated by a non empty table of guests
+#define GUEST_TABLE_MIN_CAPACITY 4
+
+// Number of guests under which two tables are compared scanning them, instead of searching on their index
+#define GUEST_TABLE_EQUALS_SCAN_THRESHOLD 8
 
 // Definition of a guest
 typedef struct {
@@ -21,11 +29,26 @@ typedef struct {
     // Using dynamic memory, the elements is a pointer to a region of memory. Initially, we have no memory (NULL), and we need to allocate memory when we want to add elements. We can add as many elements as we want, the only limit is the total amount of memory of our computer.
     tGuest* elements;
     
+    // Number of elements that fit on the allocated memory. The memory grows and shrinks geometrically, so adding or removing elements does not reallocate it each time.
+    unsigned int capacity;
+    
+    // Hash index over the username of the elements, used to find a guest without scanning the whole table
+    tHashIndex index;
+    
+    // Hash of the usernames of the elements, independent of their order. Tables with different hashes have different guests.
+    unsigned int contentHash;
+    
+    // The fields of the guests are shared with their owner (an arena) instead of being copied, so the table does not release them
+    bool shared;
+    
 } tGuestTable;
 
 // Initialize the guest structure
 tError guest_init(tGuest* object, const char* username, const char* name, const char* mail);
 
+// Initialize the guest structure, taking the memory of the fields from an arena. The guest is released with the arena, not with guest_free.
+tError guest_initArena(tGuest* object, tArena* arena, const char* username, const char* name, const char* mail);
+
 // Remove the memory used by guest structure
 void guest_free(tGuest* object);
 
@@ -45,12 +68,24 @@ void guestTable_init(tGuestTable* table);
 // Remove the memory used by guestTable structure
 void guestTable_free(tGuestTable* object);
 
+// Allocate memory for at least capacity elements
+tError guestTable_reserve(tGuestTable* table, unsigned int capacity);
+
 // Add a new guest to the table
 tError guestTable_add(tGuestTable* table, tGuest* guest);
 
-// Remove a guest from the table
+// Add many guests to the table. Guests already on the table or repeated on the array are skipped, and ERR_DUPLICATED is returned. Guests with an invalid mail are skipped too, returning ERR_INVALID.
+tError guestTable_addMany(tGuestTable* table, tGuest* guests, unsigned int count);
+
+// Add many guests to the table without copying their fields, which must be kept while the table is used. The guests are skipped as in guestTable_addMany. The table does not release the fields of its guests anymore.
+tError guestTable_addManyShared(tGuestTable* table, tGuest* guests, unsigned int count);
+
+// Remove a guest from the table, keeping the order of the other guests
 tError guestTable_remove(tGuestTable* table, tGuest* guest);
 
+// Remove a guest from the table in constant time. The last guest of the table takes its position.
+tError guestTable_removeUnordered(tGuestTable* table, tGuest* guest);
+
 // Get guest by username
 tGuest* guestTable_find(tGuestTable* table, const char* username);
 
@@ -0,0 +1,61 @@
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <stdbool.h>
+#include "error.h"
+
+// Minimum number of slots of a hash index. Must be a power of two.
+#define HASH_INDEX_MIN_CAPACITY 8
+
+// Slot of a hash index. A position of 0 means an empty slot, otherwise it stores the position of the element on the indexed table plus 1.
+typedef struct {
+    unsigned int hash;
+    unsigned int position;
+} tHashSlot;
+
+// Open addressing index (linear probing) over the positions of a table, keyed by a string field of its elements
+typedef struct {
+    // Number of slots. It is always 0 or a power of two.
+    unsigned int capacity;
+
+    // Number of used slots
+    unsigned int count;
+
+    // Array of slots. NULL while the index is empty.
+    tHashSlot* slots;
+} tHashIndex;
+
+// Function used by the index to get the key of the element stored on a position of the indexed table
+typedef const char* (*tHashKeyFunction)(const void* table, unsigned int position);
+
+// Compute the hash value of a string
+unsigned int hash_string(const char* str);
+
+// Initialize the hash index
+void hashIndex_init(tHashIndex* index);
+
+// Remove the memory used by the hash index
+void hashIndex_free(tHashIndex* index);
+
+// Remove all the entries of the hash index, keeping the allocated slots
+void hashIndex_clear(tHashIndex* index);
+
+// Make room for at least count entries without rehashing
+tError hashIndex_reserve(tHashIndex* index, unsigned int count);
+
+// Add the position of an element with the given key hash
+tError hashIndex_insert(tHashIndex* index, unsigned int hash, unsigned int position);
+
+// Get the position of the element with the given key, or -1 if it is not indexed
+int hashIndex_find(tHashIndex* index, const char* key, unsigned int hash, tHashKeyFunction getKey, const void* table);
+
+// Remove the entry of the element stored on a position
+bool hashIndex_remove(tHashIndex* index, unsigned int hash, unsigned int position);
+
+// Change the position stored for an element, after it is moved on the indexed table
+bool hashIndex_update(tHashIndex* index, unsigned int hash, unsigned int position, unsigned int newPosition);
+
+// Decrease by one all the positions after the given one, after an element is removed and the next ones displaced
+void hashIndex_shift(tHashIndex* index, unsigned int position);
+
+#endif // __HASH_H__
@@ -0,0 +1,42 @@
+#ifndef __IMPORTER_H__
+#define __IMPORTER_H__
+
+#include <stdio.h>
+#include "error.h"
+#include "congress.h"
+
+// Size of the buffer used to read the input. Longer lines are rejected.
+#define IMPORTER_BUFFER_SIZE 65536
+
+// Number of guests or presentations added to the congress at once
+#define IMPORTER_BATCH_SIZE 4096
+
+// Maximum number of fields of a row
+#define IMPORTER_MAX_FIELDS 8
+
+// Formats of the rows of an import
+typedef enum {
+    // Comma separated values. The first field is the type of the row: guest,<username>,<name>,<mail> | organization,<name> | presentation,<organization>,<score>,<title>,<topic>.
+    // Fields can be quoted with '"', writing '""' for a quote inside them.
+    IMPORT_CSV,
+    // One JSON object per line, with the same fields and a "type" field: {"type":"presentation","organization":"org","score":7.5,"title":"t","topic":"t"}
+    IMPORT_JSON_LINES
+} tImportFormat;
+
+// Result of an import
+typedef struct {
+    // Rows added to the congress and rows rejected. Empty lines and lines starting with '#' are not counted.
+    unsigned long rows;
+    unsigned long rejected;
+    // Bytes read from the input
+    unsigned long long bytes;
+    // Time used by the import, in seconds, and rows added per second
+    double seconds;
+    double rowsPerSecond;
+} tImportStats;
+
+// Import the rows of a stream into a congress. The organizations are registered with the given table of guests, where the guests are added.
+// Invalid rows are rejected and the import goes on. Returns ERR_CANNOT_READ if the stream cannot be read, or ERR_MEMORY_ERROR if there is no memory.
+tError congress_import(tCongress* object, tGuestTable* guests, FILE* input, tImportFormat format, tImportStats* stats);
+
+#endif // __IMPORTER_H__
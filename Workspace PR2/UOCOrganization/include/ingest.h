@@ -0,0 +1,45 @@
+#ifndef __INGEST_H__
+#define __INGEST_H__
+
+#include <stdbool.h>
+#include "error.h"
+#include "congress.h"
+
+// Maximum number of presentations added to the congress at once when an ingest queue is drained
+#define INGEST_BATCH_SIZE 256
+
+// Node of an ingest queue, with a presentation submitted by a producer. Its strings are stored on the same allocation, after the node.
+typedef struct _tIngestNode {
+    struct _tIngestNode* next;
+    tPresentationData data;
+} tIngestNode;
+
+// Lock free queue of presentations with many producers and a single consumer (Vyukov's intrusive MPSC queue).
+// Producers push with an atomic exchange of the head and never wait. The consumer takes the nodes from the tail, and a stub node keeps the queue linked when it is empty.
+typedef struct {
+    // Last node pushed, changed by all the producers
+    tIngestNode* head;
+    // Next node to take, only used by the consumer
+    tIngestNode* tail;
+    tIngestNode stub;
+    // Presentations taken by the consumer that were added to the congress, and that were rejected by it
+    unsigned long added;
+    unsigned long rejected;
+} tIngestQueue;
+
+// Initialize the queue
+void ingestQueue_init(tIngestQueue* queue);
+
+// Remove the queue and the presentations still on it. No producer can use it.
+void ingestQueue_free(tIngestQueue* queue);
+
+// Submit a presentation. It can be called from any number of threads at the same time, without locks. The strings are copied.
+tError ingestQueue_push(tIngestQueue* queue, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic);
+
+// Check if the consumer has no presentations to take. Presentations being pushed may not be seen yet.
+bool ingestQueue_empty(tIngestQueue* queue);
+
+// Take up to max presentations of the queue and add them to the congress, in batches. Only the consumer thread can call it. Returns the number of presentations taken.
+unsigned int congress_drainIngestQueue(tCongress* object, tIngestQueue* queue, unsigned int max);
+
+#endif // __INGEST_H__
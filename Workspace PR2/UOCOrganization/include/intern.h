@@ -0,0 +1,47 @@
+#ifndef __INTERN_H__
+#define __INTERN_H__
+
+#include "error.h"
+#include "hash.h"
+#include "arena.h"
+
+// Identifier of a string that is not interned. Valid identifiers start at 1.
+#define INTERN_NO_ID 0
+
+// Table of unique strings. Each string is stored once and identified by a number, so equal strings can be compared as integers.
+typedef struct {
+    // Number of strings
+    unsigned int size;
+
+    // Number of strings that fit on the allocated memory
+    unsigned int capacity;
+
+    // Array of strings. The identifier of a string is its position plus 1.
+    const char** strings;
+
+    // Hash index over the strings
+    tHashIndex index;
+
+    // Arena where the strings are stored
+    tArena* arena;
+} tInternTable;
+
+// Initialize the intern table, storing the strings on the given arena
+void internTable_init(tInternTable* table, tArena* arena);
+
+// Remove the memory used by the intern table. The strings are released with the arena.
+void internTable_free(tInternTable* table);
+
+// Get the identifier of a string, adding it to the table if needed. Returns INTERN_NO_ID if there is no memory.
+unsigned int internTable_add(tInternTable* table, const char* str);
+
+// Get the identifier of a string, adding it to the table without copying it if needed. The string must be kept on the arena of the table, or live longer than it.
+unsigned int internTable_addShared(tInternTable* table, const char* str);
+
+// Get the identifier of a string, or INTERN_NO_ID if it is not on the table
+unsigned int internTable_find(tInternTable* table, const char* str);
+
+// Get the canonical copy of the string with the given identifier
+const char* internTable_get(tInternTable* table, unsigned int id);
+
+#endif // __INTERN_H__
@@ -4,30 +4,47 @@
 #include <stdbool.h>
 #include "guest.h"
 
+// Minimum number of elements allocated by a non empty table of organizations
+#define ORGANIZATION_TABLE_MIN_CAPACITY 4
+
 // Definition of an organization
 typedef struct {
     char* name;
     tGuestTable* guests;    
+    // Identifier given when the organization is initialized, and kept by its copies. 0 for an empty organization.
+    unsigned int id;
+    // Number of organizations sharing the name, stored on the same block just before it. NULL if the name is not owned, as the names taken from an arena.
+    unsigned int* references;
 } tOrganization;
 
 // Table of organization
 typedef struct {
     unsigned int size;
     tOrganization* elements;
+    // Number of elements that fit on the allocated memory
+    unsigned int capacity;
+    // Arena used for the names of the elements. When it is NULL, each name is allocated with malloc.
+    tArena* arena;
 } tOrganizationTable;
 
 // Initialize the organization structure
 tError organization_init(tOrganization* organization, const char* name, tGuestTable* guests);
 
+// Initialize the organization structure, taking the memory of the name from an arena. The organization is released with the arena, not with organization_free.
+tError organization_initArena(tOrganization* organization, tArena* arena, const char* name, tGuestTable* guests);
+
 // Remove the memory used by organization structure
 void organization_free(tOrganization* object);
 
 // Compare two organizations
 bool organization_equals(tOrganization* organization1, tOrganization* organization2);
 
-// Copy the data of a organization to another organization
+// Copy the data of a organization to another organization. The copy shares the name of the source instead of allocating it again.
 tError organization_cpy(tOrganization* dest, tOrganization* src);
 
+// Move the data of a organization to another organization, without copying the name
+void organization_move(tOrganization* dest, tOrganization* src);
+
 // Get the guests of a organization
 tGuestTable* organization_getGuests(tOrganization* organization);
 
@@ -35,12 +52,24 @@ tGuestTable* organization_getGuests(tOrganization* organization);
 // Initialize the Table of organizations
 void organizationTable_init(tOrganizationTable* table);
 
+// Initialize the Table of organizations, using an arena for the names of the elements
+void organizationTable_initArena(tOrganizationTable* table, tArena* arena);
+
 // Remove the memory used by organizationrTable structure
 void organizationTable_free(tOrganizationTable* object);
 
+// Allocate memory for at least capacity elements
+tError organizationTable_reserve(tOrganizationTable* table, unsigned int capacity);
+
 // Add a new organization to the table
 tError organizationTable_add(tOrganizationTable* table, tOrganization* organization);
 
+// Add an organization that is known not to be on the table, without searching it. Used to add many organizations checked at once.
+tError organizationTable_append(tOrganizationTable* table, tOrganization* organization);
+
+// Add an organization that is known not to be on the table, sharing its name instead of copying it. The name is not released by the table, so it must be kept while the table is used, as the names of an arena.
+tError organizationTable_appendShared(tOrganizationTable* table, tOrganization* organization);
+
 // Delete a organization from the table
 tError organizationTable_remove(tOrganizationTable* table, tOrganization* organization);
 
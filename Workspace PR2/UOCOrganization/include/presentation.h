@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include "organization.h"
+#include "intern.h"
 
 // Definition of a presentation structure
 typedef struct {
@@ -10,6 +11,9 @@ typedef struct {
     char* presentationTopic;
     tOrganization organization; 
     double score; 
+    // Identifiers of the topic and the organization name on the intern table of a congress, or INTERN_NO_ID if the strings are not interned
+    unsigned int topicId;
+    unsigned int organizationId;
 } tPresentation;
 
 
@@ -20,12 +24,81 @@ typedef struct _tPresentationQueueNode {
 } tPresentationQueueNode;
 
 
+// Number of nodes allocated together by a pool of nodes
+#define PRESENTATION_NODE_POOL_SLAB_SIZE 64
+
+// Block of nodes allocated by a pool
+typedef struct _tPresentationNodeSlab {
+    struct _tPresentationNodeSlab* next;
+    tPresentationQueueNode nodes[PRESENTATION_NODE_POOL_SLAB_SIZE];
+} tPresentationNodeSlab;
+
+// Statistics of a pool of nodes
+typedef struct {
+    // Number of slabs and of nodes allocated with malloc
+    unsigned int slabs;
+    unsigned int nodes;
+    // Number of nodes currently used by queues, and the maximum reached
+    unsigned int used;
+    unsigned int peak;
+    // Number of nodes requested, and how many of them were recycled from previously released nodes
+    unsigned long requests;
+    unsigned long reuses;
+} tPresentationNodePoolStats;
+
+// Pool of queue nodes. Released nodes are kept on a free list and given again to the next requests, instead of returning them to the system.
+typedef struct {
+    // List of slabs, released by presentationNodePool_free
+    tPresentationNodeSlab* slabs;
+    // List of slabs reserved for the next requests, which have never been used
+    tPresentationNodeSlab* spare;
+    // List of free nodes, linked by their next field
+    tPresentationQueueNode* freeList;
+    // Number of nodes of the first slab that have never been used
+    unsigned int fresh;
+    tPresentationNodePoolStats stats;
+} tPresentationNodePool;
+
+// Minimum number of presentations allocated by a non empty ring queue. Must be a power of two.
+#define PRESENTATION_QUEUE_MIN_CAPACITY 8
+
+// Ways of storing the presentations of a queue
+typedef enum {
+    // Linked list of nodes, using the first and last fields
+    PRESENTATION_QUEUE_LIST,
+    // Growable circular array, using the elements, capacity, head and count fields
+    PRESENTATION_QUEUE_RING
+} tPresentationQueueType;
+
 // Definition of a queue of presentations
 typedef struct {
     tPresentationQueueNode* first;
     tPresentationQueueNode* last;
+    // Arena used for the strings of the enqueued presentations. When it is NULL, each string is allocated with malloc.
+    tArena* arena;
+    // Pool used for the nodes of a list queue. When it is NULL, each node is allocated with malloc.
+    tPresentationNodePool* pool;
+    
+    // Storage used by the queue
+    tPresentationQueueType type;
+    
+    // Array of presentations of a ring queue. The capacity is always 0 or a power of two.
+    tPresentation* elements;
+    unsigned int capacity;
+    // Position of the first presentation and number of presentations on the array
+    unsigned int head;
+    unsigned int count;
 } tPresentationQueue;
 
+// Read only cursor over the presentations of a queue, from the head to the last one. The queue must not be modified while it is used.
+typedef struct {
+    tPresentationQueue* queue;
+    // Current node of a list queue
+    tPresentationQueueNode* node;
+    // Number of presentations of a ring queue before the current one
+    unsigned int position;
+} tPresentationQueueIterator;
+
 
 
 // Compare two organization scores
@@ -37,12 +110,18 @@ void organizationScore_duplicate(tPresentation* dst, tPresentation src);
 // Initialize a presentation structure
 void presentation_init(tPresentation *object, tOrganization *organization, double score, const char* presentationTitle, const char* presentationTopic);
 
+// Initialize a presentation structure, taking the memory of the strings from an arena
+tError presentation_initArena(tPresentation *object, tArena* arena, tOrganization *organization, double score, const char* presentationTitle, const char* presentationTopic);
+
 // Compare two presentations
 bool presentation_compare(tPresentation p1, tPresentation p2);
 
 // Duplicate a presentation
 void presentation_duplicate(tPresentation* dst, tPresentation src);
 
+// Duplicate a presentation, taking the memory of the strings from an arena. Interned strings and organization names with references are shared instead of copied.
+tError presentation_duplicateArena(tPresentation* dst, tArena* arena, tPresentation src);
+
 // Implementation of compare method between two presentations queues using iterative algorithm
 bool presentationQueue_compareIterative(tPresentationQueue *q1, tPresentationQueue *q2);
 
@@ -58,15 +137,42 @@ void presentationQueue_duplicate(tPresentationQueue* dst, tPresentationQueue src
 // Create the presentation queue
 void presentationQueue_createQueue(tPresentationQueue* queue);
 
+// Create the presentation queue, using an arena for the strings of the presentations
+void presentationQueue_createQueueArena(tPresentationQueue* queue, tArena* arena);
+
+// Create the presentation queue with the given storage. The arena can be NULL to allocate the strings with malloc.
+void presentationQueue_createQueueType(tPresentationQueue* queue, tPresentationQueueType type, tArena* arena);
+
+// Use a pool for the nodes of an empty queue
+void presentationQueue_setPool(tPresentationQueue* queue, tPresentationNodePool* pool);
+
+// Make room for count more presentations, so they are enqueued without reallocating the storage of a ring queue, or allocating the nodes of a list queue with a pool
+tError presentationQueue_reserve(tPresentationQueue* queue, unsigned int count);
+
 // Enqueue a new match to the match queue
 tError presentationQueue_enqueue(tPresentationQueue* queue, tPresentation presentation);
 
-// Dequeue a presentation from the presentation queue
+// Enqueue a presentation whose title and topic are already on the arena of the queue, without copying them. Only a reference to the name of its organization is taken.
+tError presentationQueue_enqueueShared(tPresentationQueue* queue, tPresentation presentation);
+
+// Dequeue a presentation from the presentation queue, releasing its reference to the name of its organization
 void presentationQueue_dequeue(tPresentationQueue* queue);
 
 // Return the first element from the queue
 tPresentation* presentationQueue_head(tPresentationQueue queue);
 
+// Return the last element from the queue
+tPresentation* presentationQueue_last(tPresentationQueue queue);
+
+// Place a cursor on the head of the queue
+void presentationQueue_begin(tPresentationQueue* queue, tPresentationQueueIterator* it);
+
+// Move a cursor to the next presentation
+void presentationQueue_next(tPresentationQueueIterator* it);
+
+// Get the presentation of a cursor, or NULL if it is after the last one
+tPresentation* presentationQueue_get(tPresentationQueueIterator* it);
+
 // Check if the queue is empty
 bool presentationQueue_empty(tPresentationQueue queue);
 
@@ -76,7 +182,32 @@ void presentationQueue_free(tPresentationQueue* queue);
 // Get the average score for an organization
 double presentationQueue_getOrganizationScoreRecursive(tPresentationQueue *queue, tOrganization *organization);
 
+// Get the average score for an organization, using an iterative algorithm. The result is the same as the recursive one.
+double presentationQueue_getOrganizationScoreIterative(tPresentationQueue *queue, tOrganization *organization);
+
 // Get a queue with all the presentations for an organization
 tError presentationQueue_getOrganizationPresentationsRecursive(tPresentationQueue *queue, tOrganization *organization, tPresentationQueue* presentations);
 
+// Get a queue with all the presentations for an organization, using an iterative algorithm. The result is the same as the recursive one.
+tError presentationQueue_getOrganizationPresentationsIterative(tPresentationQueue *queue, tOrganization *organization, tPresentationQueue* presentations);
+
+
+// Initialize a pool of queue nodes
+void presentationNodePool_init(tPresentationNodePool* pool);
+
+// Remove the memory used by a pool of queue nodes. The queues using it must not be used anymore.
+void presentationNodePool_free(tPresentationNodePool* pool);
+
+// Get a node from the pool. Returns NULL if there is no memory.
+tPresentationQueueNode* presentationNodePool_alloc(tPresentationNodePool* pool);
+
+// Make room for count more nodes, so they are taken from the pool without allocating memory
+tError presentationNodePool_reserve(tPresentationNodePool* pool, unsigned int count);
+
+// Give back a node to the pool, to be used again
+void presentationNodePool_release(tPresentationNodePool* pool, tPresentationQueueNode* node);
+
+// Get the statistics of a pool of queue nodes
+tPresentationNodePoolStats presentationNodePool_getStats(tPresentationNodePool* pool);
+
 #endif // __PRESENTATION_H__
\ No newline at end of file
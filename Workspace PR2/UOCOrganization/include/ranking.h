@@ -0,0 +1,104 @@
+#ifndef __RANKING_H__
+#define __RANKING_H__
+
+#include <stdbool.h>
+#include "error.h"
+
+// Minimum number of slots of the best scores of the organizations. Must be a power of two.
+#define RANKING_MIN_CAPACITY 16
+
+// Best scores on a topic
+typedef struct {
+    // The topic has presentations
+    bool used;
+    // Best score on the topic, and the organization that got it first
+    double best;
+    unsigned int bestOrganizationId;
+    // Best score of the other organizations, if any of them has presentations on the topic
+    bool hasRunnerUp;
+    double runnerUp;
+} tTopicRanking;
+
+// Running aggregates of the scores of the presentations of an organization
+typedef struct {
+    unsigned int count;
+    double sum;
+    double min;
+    double max;
+} tScoreStats;
+
+// Best score of an organization on a topic. An organizationId of 0 means an empty slot.
+typedef struct {
+    unsigned int topicId;
+    unsigned int organizationId;
+    double best;
+} tRankingSlot;
+
+// Topic of the list of topics of an organization. The next one is a position on the array of topics of the organizations plus 1, or 0 at the end of the list.
+typedef struct {
+    unsigned int topicId;
+    unsigned int next;
+} tRankingTopic;
+
+// List of the topics where an organization has presentations, as positions on the array of topics of the organizations plus 1
+typedef struct {
+    unsigned int first;
+    unsigned int last;
+} tRankingTopicList;
+
+// Index of the best scores of the presentations, by topic and by organization, and of the score aggregates of each organization. Topics and organizations are identified by their intern identifiers.
+typedef struct {
+    // Array of topics, indexed by their identifier
+    tTopicRanking* topics;
+    unsigned int topicsCapacity;
+
+    // Array of score aggregates of the organizations, and of the lists of their topics, indexed by their identifier
+    tScoreStats* organizations;
+    tRankingTopicList* organizationTopics;
+    unsigned int organizationsCapacity;
+
+    // Topics of all the organizations, linked on a list for each one
+    tRankingTopic* organizationTopicsArray;
+    unsigned int organizationTopicsCount;
+    unsigned int organizationTopicsCapacity;
+
+    // Open addressing table (linear probing) with the best score of each organization on each topic
+    tRankingSlot* slots;
+    unsigned int capacity;
+    unsigned int count;
+} tRanking;
+
+// Cursor over the topics where an organization has presentations
+typedef struct {
+    tRanking* ranking;
+    unsigned int position;
+} tRankingTopicIterator;
+
+// Initialize the ranking
+void ranking_init(tRanking* ranking);
+
+// Remove the memory used by the ranking
+void ranking_free(tRanking* ranking);
+
+// Add the score of a presentation of an organization on a topic
+tError ranking_add(tRanking* ranking, unsigned int topicId, unsigned int organizationId, double score);
+
+// Get the best score of an organization on a topic. Returns false if the organization has no presentations on the topic.
+bool ranking_getBest(tRanking* ranking, unsigned int topicId, unsigned int organizationId, double* best);
+
+// Get the score aggregates of an organization. Returns false if the organization has no presentations.
+bool ranking_getStats(tRanking* ranking, unsigned int organizationId, tScoreStats* stats);
+
+// Get if an organization wins on a topic: 3 if it has the best score, 1 if it draws, 0 otherwise, or ERR_NOT_EXISTS if the topic has no presentations
+int ranking_getWins(tRanking* ranking, unsigned int topicId, unsigned int organizationId);
+
+// Place a cursor on the first topic where an organization has presentations. The topics are walked in the order of the first presentation of the organization on each one.
+void ranking_beginTopics(tRanking* ranking, unsigned int organizationId, tRankingTopicIterator* it);
+
+// Move a cursor to the next topic
+void ranking_nextTopic(tRankingTopicIterator* it);
+
+// Get the identifier of the topic of a cursor, or 0 after the last one
+unsigned int ranking_getTopic(tRankingTopicIterator* it);
+
+#endif // __RANKING_H__
@@ -0,0 +1,43 @@
+#ifndef __RWLOCK_H__
+#define __RWLOCK_H__
+
+#include "error.h"
+
+#ifdef _WIN32
+// Slim reader/writer locks are available since Windows Vista
+#ifndef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Reader-writer lock. Many readers can hold it at the same time, while a writer holds it alone.
+typedef struct {
+#ifdef _WIN32
+    SRWLOCK lock;
+#else
+    pthread_rwlock_t lock;
+#endif
+} tRWLock;
+
+// Initialize the lock
+tError rwLock_init(tRWLock* lock);
+
+// Remove the resources of the lock, which must not be held
+void rwLock_free(tRWLock* lock);
+
+// Take the lock for reading, waiting for the writer that holds it, if any
+void rwLock_readLock(tRWLock* lock);
+
+// Release the lock taken for reading
+void rwLock_readUnlock(tRWLock* lock);
+
+// Take the lock for writing, waiting for all the readers and the writer that hold it
+void rwLock_writeLock(tRWLock* lock);
+
+// Release the lock taken for writing
+void rwLock_writeUnlock(tRWLock* lock);
+
+#endif // __RWLOCK_H__
@@ -0,0 +1,54 @@
+#ifndef __SHARED_H__
+#define __SHARED_H__
+
+#include "error.h"
+#include "congress.h"
+#include "rwlock.h"
+
+// Congress shared by many threads. The queries take the lock for reading, so they run at the same time, and the changes take it for writing.
+// The tables of guests of the organizations are not protected by the lock, so they must not be changed while the congress is shared.
+typedef struct {
+    tCongress congress;
+    tRWLock lock;
+} tSharedCongress;
+
+// Initialize the shared congress
+tError sharedCongress_init(tSharedCongress* object, char* name);
+
+// Initialize the shared congress, storing the presentations on the given type of queue
+tError sharedCongress_initQueueType(tSharedCongress* object, char* name, tPresentationQueueType queueType);
+
+// Remove all data for a shared congress. No other thread can use it.
+void sharedCongress_free(tSharedCongress* object);
+
+// Register a new organization to the congress
+tError sharedCongress_registerOrganization(tSharedCongress* object, tOrganization* organization);
+
+// Remove an organization from the congress
+tError sharedCongress_removeOrganization(tSharedCongress* object, tOrganization* organization);
+
+// Get all the guests of the congress
+tError sharedCongress_getGuests(tSharedCongress* object, tGuestTable* guests);
+
+// Add a new presentation
+tError sharedCongress_addPresentation(tSharedCongress* object, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic);
+
+// Add many presentations at once, taking the lock once for all of them. Returns the number of presentations added.
+unsigned int sharedCongress_addPresentationsBatch(tSharedCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors);
+
+// Get if an organization wins on a topic
+int sharedCongress_getOrganizationWins(tSharedCongress* object, const char* organization_name, const char* topic);
+
+// Get the total score for an organization
+double sharedCongress_getOrganizationScore(tSharedCongress* object, const char* organization_name);
+
+// Get the average score for an organization
+double sharedCongress_getOrganizationAverage(tSharedCongress* object, const char* organization_name);
+
+// Get the number, total, minimum and maximum of the scores of an organization, all of them from the same state of the congress
+tError sharedCongress_getOrganizationStats(tSharedCongress* object, const char* organization_name, tScoreStats* stats);
+
+// Get a queue with a copy of all the presentations for an organization. Views are not available, as they would not be protected by the lock.
+tError sharedCongress_getOrganizationPresentations(tSharedCongress* object, const char* organization_name, tPresentationQueue* presentations);
+
+#endif // __SHARED_H__
@@ -0,0 +1,63 @@
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include <stdint.h>
+#include "error.h"
+#include "congress.h"
+
+// First bytes of a snapshot file ("UOCC") and version of its format
+#define SNAPSHOT_MAGIC 0x43434F55u
+#define SNAPSHOT_VERSION 1
+
+// Header of a snapshot. It is followed by the arrays of presentations, organizations, guest tables, guests, string offsets and the string bytes, in this order.
+// The strings are identified by their position on the offsets array plus 1. All the values are stored with the byte order of the machine that writes them.
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    // Type of the presentations queue and name of the congress
+    uint32_t queueType;
+    uint32_t name;
+    // Number of elements of each array, and number of bytes of the strings
+    uint32_t presentations;
+    uint32_t organizations;
+    uint32_t guestTables;
+    uint32_t guests;
+    uint32_t strings;
+    uint32_t stringsSize;
+} tSnapshotHeader;
+
+// Record of a presentation. The organization is a position on the organizations array.
+typedef struct {
+    double score;
+    uint32_t organization;
+    uint32_t title;
+    uint32_t topic;
+    uint32_t reserved;
+} tSnapshotPresentation;
+
+// Record of an organization. The guest table is a position on the guest tables array.
+typedef struct {
+    uint32_t name;
+    uint32_t guestTable;
+} tSnapshotOrganization;
+
+// Record of a table of guests, as a range of the guests array
+typedef struct {
+    uint32_t first;
+    uint32_t count;
+} tSnapshotGuestTable;
+
+// Record of a guest
+typedef struct {
+    uint32_t username;
+    uint32_t name;
+    uint32_t mail;
+} tSnapshotGuest;
+
+// Write the congress to a snapshot file. The presentations of organizations that are not registered anymore are not written.
+tError congress_save(tCongress* object, const char* path);
+
+// Initialize a congress with the data of a snapshot file. The file is mapped on memory, and the strings are copied to the arena of the congress with a single allocation. The guests, organizations and presentations share those strings.
+tError congress_load(tCongress* object, const char* path);
+
+#endif // __SNAPSHOT_H__
@@ -0,0 +1,33 @@
+#ifndef __THREAD_H__
+#define __THREAD_H__
+
+#include "error.h"
+
+#ifdef _WIN32
+#ifndef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Thread of the system
+typedef struct {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+} tThread;
+
+// Function run by a thread
+typedef void (*tThreadFunction)(void* arg);
+
+// Start a thread running function(arg)
+tError thread_start(tThread* thread, tThreadFunction function, void* arg);
+
+// Wait for the end of a thread, and remove its resources
+void thread_join(tThread* thread);
+
+#endif // __THREAD_H__
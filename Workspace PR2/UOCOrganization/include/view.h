@@ -0,0 +1,45 @@
+#ifndef __VIEW_H__
+#define __VIEW_H__
+
+#include "error.h"
+#include "presentation.h"
+
+// Minimum number of presentations of an organization, and of organizations, allocated by an index. Must be a power of two.
+#define PRESENTATION_INDEX_MIN_CAPACITY 8
+
+// Read only view over some presentations stored on a queue. The presentations are not copied.
+typedef struct {
+    tPresentation** elements;
+    unsigned int size;
+    unsigned int capacity;
+} tPresentationView;
+
+// Index of the presentations of a queue by organization. The organizations are identified by their intern identifiers.
+typedef struct {
+    // Array of views, indexed by the identifier of the organization
+    tPresentationView* organizations;
+    unsigned int capacity;
+} tPresentationIndex;
+
+// Initialize the index
+void presentationIndex_init(tPresentationIndex* index);
+
+// Remove the memory used by the index. The presentations are not removed.
+void presentationIndex_free(tPresentationIndex* index);
+
+// Remove all the presentations of the index, keeping its memory
+void presentationIndex_clear(tPresentationIndex* index);
+
+// Add a presentation of an organization to the index
+tError presentationIndex_add(tPresentationIndex* index, unsigned int organizationId, tPresentation* presentation);
+
+// Get the view of the presentations of an organization. It is empty if the organization has no presentations.
+void presentationIndex_getView(tPresentationIndex* index, unsigned int organizationId, tPresentationView* view);
+
+// Get the number of presentations of a view
+unsigned int presentationView_size(tPresentationView view);
+
+// Get a presentation of a view, in the order they were added
+tPresentation* presentationView_get(tPresentationView view, unsigned int position);
+
+#endif // __VIEW_H__
@@ -0,0 +1,94 @@
+#ifndef __WAL_H__
+#define __WAL_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "error.h"
+#include "congress.h"
+
+// First bytes of a log file ("UOCW") and version of its format
+#define WAL_MAGIC 0x57434F55u
+#define WAL_VERSION 2
+
+// Initial size of the buffer of the records waiting to be written. Larger records grow it.
+#define WAL_BUFFER_SIZE 65536
+
+// Maximum size of a record. Longer lengths on a log are taken as a damaged record.
+#define WAL_MAX_RECORD_SIZE (16 * 1024 * 1024)
+
+// Maximum number of guests of a record. Larger tables of guests are written on several records.
+#define WAL_GUESTS_PER_RECORD 1024
+
+// Number of consecutive presentation records added to the congress at once by a replay
+#define WAL_REPLAY_BATCH_SIZE 4096
+
+// Types of the records of a log
+typedef enum {
+    // Name of the organization and number of its table of guests on the log
+    WAL_RECORD_REGISTER_ORGANIZATION = 1,
+    WAL_RECORD_REMOVE_ORGANIZATION = 2,
+    WAL_RECORD_ADD_PRESENTATION = 3,
+    // New table of guests, numbered from 1 in the order of the log. Its guests are on the next records.
+    WAL_RECORD_GUEST_TABLE = 4,
+    // Username, name and mail of guests of the last table of guests
+    WAL_RECORD_ADD_GUESTS = 5
+} tWalRecordType;
+
+// Table of guests written to a log
+typedef struct {
+    tGuestTable* table;
+    // Size and content hash of the table when it was written. A table changed after that is written again.
+    unsigned int size;
+    unsigned int contentHash;
+    // Number of the table on the log
+    uint32_t number;
+} tWalGuestTable;
+
+// Append only log of the changes of a congress. Each record is stored as its length, its type and fields, and a checksum of them.
+// The records are kept on memory and written to the file with a single fsync for each group of them, so a crash loses at most the last group.
+typedef struct {
+    int fd;
+    // Records waiting to be written
+    char* buffer;
+    size_t used;
+    size_t capacity;
+    // Size of the data written to the file. A write that fails is cut back to it, so the records waiting are written again by the next commit.
+    long long size;
+    // A failed write could not be cut, or a sync failed. No more records are accepted.
+    bool failed;
+    // Tables of guests written to the log, sorted by address, and number of tables on the log
+    tWalGuestTable* tables;
+    unsigned int tablesCount;
+    unsigned int tablesCapacity;
+    uint32_t lastTable;
+    // Number of records waiting for a commit, and number of records of each commit
+    unsigned int pending;
+    unsigned int groupSize;
+    // Number of records read when the log was opened, and number of commits done since then
+    unsigned long replayed;
+    unsigned long commits;
+} tWal;
+
+// Open a log, creating it if it does not exist. The records already on the log are applied to the congress. The organizations are registered with tables of guests owned by the congress, holding the guests they had when they were logged.
+// A damaged record at the end of the log, left by a crash while writing it, is removed. Returns ERR_CANNOT_READ or ERR_CANNOT_WRITE if the file cannot be used, or ERR_INVALID if it is not a log.
+tError wal_open(tWal* wal, const char* path, unsigned int groupSize, tCongress* object);
+
+// Write and sync the records waiting on the log
+tError wal_commit(tWal* wal);
+
+// Commit the records waiting on the log and close it
+tError wal_close(tWal* wal);
+
+// The logged changes are added to the log before they are applied. A change that cannot be logged or applied is removed from the log and not applied.
+// If the commit of a complete group fails, ERR_CANNOT_WRITE is returned with the change applied and its records waiting on the log, to be written by the next commit.
+
+// Register an organization on the congress, and add the change to the log. Its table of guests is logged the first time it is used, and again if it changes.
+tError congress_registerOrganizationLogged(tCongress* object, tWal* wal, tOrganization* organization);
+
+// Remove an organization from the congress, and add the change to the log
+tError congress_removeOrganizationLogged(tCongress* object, tWal* wal, tOrganization* organization);
+
+// Add a presentation to the congress, and add the change to the log
+tError congress_addPresentationLogged(tCongress* object, tWal* wal, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic);
+
+#endif // __WAL_H__
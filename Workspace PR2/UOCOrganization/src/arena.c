@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "arena.h"
+
+// Alignment of the values allocated from an arena
+#define ARENA_ALIGNMENT sizeof(void*)
+
+// Initialize the arena
+void arena_init(tArena* arena) {
+    // Verify pre conditions
+    assert(arena != NULL);
+
+    // An empty arena has no blocks. They are allocated on demand.
+    arena->blocks = NULL;
+}
+
+// Remove all the memory of the arena, including all the values allocated from it
+void arena_free(tArena* arena) {
+    tArenaBlock* block;
+
+    // Verify pre conditions
+    assert(arena != NULL);
+
+    while(arena->blocks != NULL) {
+        block = arena->blocks;
+        arena->blocks = block->next;
+        free(block);
+    }
+}
+
+// Allocate size bytes from the arena. Returns NULL if there is no memory.
+void* arena_alloc(tArena* arena, size_t size) {
+    tArenaBlock* block;
+    size_t offset;
+
+    // Verify pre conditions
+    assert(arena != NULL);
+
+    // Take the memory from the current block if it fits after aligning its first free byte
+    block = arena->blocks;
+    if(block != NULL) {
+        offset = (block->used + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+        if(offset + size <= block->size) {
+            block->used = offset + size;
+            return block->data + offset;
+        }
+    }
+
+    // Otherwise, a new block is needed. Large values get a block of their own, placed after the current one so its free space is not lost.
+    if(size > ARENA_BLOCK_SIZE / 4) {
+        block = (tArenaBlock*) malloc(sizeof(tArenaBlock) + size);
+        if(block == NULL) {
+            return NULL;
+        }
+        block->size = size;
+        block->used = size;
+        if(arena->blocks == NULL) {
+            block->next = NULL;
+            arena->blocks = block;
+        } else {
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        }
+        return block->data;
+    }
+
+    block = (tArenaBlock*) malloc(sizeof(tArenaBlock) + ARENA_BLOCK_SIZE);
+    if(block == NULL) {
+        return NULL;
+    }
+    block->size = ARENA_BLOCK_SIZE;
+    block->used = size;
+    block->next = arena->blocks;
+    arena->blocks = block;
+
+    return block->data;
+}
+
+// Make a copy of a string on the arena. Returns NULL if there is no memory.
+char* arena_strdup(tArena* arena, const char* str) {
+    char* copy;
+    size_t length;
+
+    // Verify pre conditions
+    assert(arena != NULL);
+    assert(str != NULL);
+
+    // Strings do not need any alignment, but using the same allocation keeps the arena simple
+    length = strlen(str) + 1;
+    copy = (char*) arena_alloc(arena, length);
+    if(copy == NULL) {
+        return NULL;
+    }
+    memcpy(copy, str, length);
+
+    return copy;
+}
@@ -10,6 +10,13 @@
 void congress_init(tCongress* object, char* name) {
     // PR1 EX4
     
+    // The presentations are stored on a linked list
+    congress_initQueueType(object, name, PRESENTATION_QUEUE_LIST);
+}
+
+// Initialize the congress, storing the presentations on the given type of queue
+void congress_initQueueType(tCongress* object, char* name, tPresentationQueueType queueType) {
+    
     // Verify pre conditions
     assert(object != NULL);    
     assert(name != NULL);
@@ -18,27 +25,115 @@ void congress_init(tCongress* object, char* name) {
     object->name = (char*) malloc((strlen(name) + 1) * sizeof(char));   
     strcpy(object->name, name);  
    
+    // The strings of the congress data are taken from a single arena
+    arena_init(&object->strings);
+    internTable_init(&object->names, &object->strings);
+   
     object->organizations = (tOrganizationTable*) malloc(sizeof(tOrganizationTable)) ;     
-    // Initialize organizations
+    // Initialize organizations. Each one owns its name, which is shared with the presentations of the organization and their copies instead of allocated for each of them.
     organizationTable_init(object->organizations);  
+    hashIndex_init(&object->organizationIndex);
+    object->organizationIds = NULL;
+    object->organizationIdsCapacity = 0;
 
     // PR2 EX1 
     /*********	Initialize presentations queue	*************/
     // TODO 
-	presentationQueue_createQueue(&object->presentations);
+	presentationQueue_createQueueType(&object->presentations, queueType, &object->strings);
+	presentationNodePool_init(&object->nodes);
+	ranking_init(&object->ranking);
+	presentationIndex_init(&object->byOrganization);
+	object->guestTables = NULL;
+	object->guestTablesCount = 0;
+	object->guestTablesCapacity = 0;
+	presentationQueue_setPool(&object->presentations, &object->nodes);
 }
 
 // Remove all data for a congress
 void congress_free(tCongress* object) {
     // PR1 EX4
+    unsigned int i;
     assert(object!=NULL);
     // Remove data from organizations table
     organizationTable_free(object->organizations);
+    hashIndex_free(&object->organizationIndex);
+    if(object->organizationIds != NULL) {
+        free(object->organizationIds);
+        object->organizationIds = NULL;
+    }
+    object->organizationIdsCapacity = 0;
     
     // PR2 EX2    
     /************	Remove data from presentations queue	************/
     // TODO
 	presentationQueue_free(&object->presentations);
+	presentationNodePool_free(&object->nodes);
+	ranking_free(&object->ranking);
+	presentationIndex_free(&object->byOrganization);
+	
+	// The guests of the owned tables are stored on the arena, so only the tables are released
+	if(object->guestTables != NULL){
+		for(i=0; i<object->guestTablesCount; i++){
+			guestTable_free(object->guestTables[i]);
+			free(object->guestTables[i]);
+		}
+		free(object->guestTables);
+		object->guestTables = NULL;
+		object->guestTablesCount = 0;
+		object->guestTablesCapacity = 0;
+	}
+	
+	// Release all the strings of the organizations and presentations at once
+	internTable_free(&object->names);
+	arena_free(&object->strings);
+}
+
+// Get the key of the hash index of the organizations
+static const char* congress_getOrganizationKey(const void* table, unsigned int position) {
+    return ((const tOrganizationTable*) table)->elements[position].name;
+}
+
+// Get the position of a registered organization on the table, or -1 if it is not registered
+static int congress_findPosition(tCongress* object, const char* organizationName, unsigned int hash) {
+    return hashIndex_find(&object->organizationIndex, organizationName, hash, congress_getOrganizationKey, object->organizations);
+}
+
+// Register an organization, copying its name or sharing it. Its name is interned once, and used by all its presentations.
+static tError congress_insertOrganization(tCongress* object, tOrganization* organization, bool copy) {
+    unsigned int *ids;
+    unsigned int hash, id, capacity;
+    tError err;
+    
+    hash = hash_string(organization->name);
+    if(congress_findPosition(object, organization->name, hash) >= 0) {
+        return ERR_DUPLICATED;
+    }
+    
+    // The identifiers grow with the table, and the index has room for the new organization before it is added, so nothing fails after that
+    if(object->organizations->size == object->organizationIdsCapacity) {
+        capacity = (object->organizationIdsCapacity == 0) ? ORGANIZATION_TABLE_MIN_CAPACITY : object->organizationIdsCapacity * 2;
+        ids = (unsigned int*) realloc(object->organizationIds, capacity * sizeof(unsigned int));
+        if(ids == NULL) {
+            return ERR_MEMORY_ERROR;
+        }
+        object->organizationIds = ids;
+        object->organizationIdsCapacity = capacity;
+    }
+    if(hashIndex_reserve(&object->organizationIndex, object->organizations->size + 1) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+    id = copy ? internTable_add(&object->names, organization->name) : internTable_addShared(&object->names, organization->name);
+    if(id == INTERN_NO_ID) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    err = copy ? organizationTable_append(object->organizations, organization) : organizationTable_appendShared(object->organizations, organization);
+    if(err != OK) {
+        return err;
+    }
+    object->organizationIds[object->organizations->size - 1] = id;
+    
+    return hashIndex_insert(&object->organizationIndex, hash, object->organizations->size - 1);
 }
 
 // Register a new organization
@@ -48,84 +143,282 @@ tError congress_registerOrganization(tCongress* object, tOrganization* organizat
     assert(object != NULL);   
     assert(organization != NULL);   
     
-    tError err;
-    
-    // Check if the organization already exists
-    int i;
-    for(i=0; i < object->organizations->size;i++)
-    {   
-        if(organizationTable_find(object->organizations, organization->name) != NULL) {
-            return ERR_DUPLICATED;
-        }
-    }
+    // The index of the congress checks if it already exists
+    return congress_insertOrganization(object, organization, true);
+}
+
+// Register a new organization, sharing its name
+tError congress_registerOrganizationShared(tCongress* object, tOrganization* organization) {
     
-    // Add the organization to the table
-    err = organizationTable_add(object->organizations, organization);
+    assert(object != NULL);
+    assert(organization != NULL);
     
-    return err;    
+    return congress_insertOrganization(object, organization, false);
 }
 
 // Remove a organization
 tError congress_removeOrganization(tCongress* object, tOrganization* organization) {
     // PR1 EX4
+    unsigned int hash;
+    int pos;
+    
     assert(object != NULL); 
     assert(organization != NULL); 
     
-    // Get the organization with the organizationName
-    organization = organizationTable_find(object->organizations, organization->name);
+    // Get the position of the organization with the organizationName
+    hash = hash_string(organization->name);
+    pos = congress_findPosition(object, organization->name, hash);
     
-    if(organization == NULL) {
+    if(pos < 0) {
         return ERR_NOT_FOUND;
     }
     
-    return organizationTable_remove(object->organizations, organization);
+    // The organizations after the removed one are moved one position, on the index and on the identifiers too
+    hashIndex_remove(&object->organizationIndex, hash, pos);
+    hashIndex_shift(&object->organizationIndex, pos);
+    memmove(&(object->organizationIds[pos]), &(object->organizationIds[pos + 1]), (object->organizations->size - pos - 1) * sizeof(unsigned int));
+    
+    return organizationTable_remove(object->organizations, &(object->organizations->elements[pos]));
 }
 
 // Find a organization
 tOrganization* congress_findOrganization(tCongress* object, const char* organizationName) {
     // PR1 EX4   
+    int pos;
+    
     assert(object != NULL); 
     assert(organizationName != NULL);
+    
+    pos = congress_findPosition(object, organizationName, hash_string(organizationName));
+    if(pos < 0) {
+        return NULL;
+    }
  
-    return organizationTable_find(object->organizations, organizationName);
+    return &(object->organizations->elements[pos]);
 }
 
 
+// Add an empty table of guests owned by the congress
+tGuestTable* congress_addGuestTable(tCongress* object) {
+    tGuestTable **tables, *table;
+    unsigned int capacity;
+    
+    assert(object != NULL);
+    
+    // The array of tables grows geometrically. The tables are not moved, as the organizations point to them.
+    if(object->guestTablesCount == object->guestTablesCapacity) {
+        capacity = (object->guestTablesCapacity == 0) ? GUEST_TABLE_MIN_CAPACITY : object->guestTablesCapacity * 2;
+        tables = (tGuestTable**) realloc(object->guestTables, capacity * sizeof(tGuestTable*));
+        if(tables == NULL) {
+            return NULL;
+        }
+        object->guestTables = tables;
+        object->guestTablesCapacity = capacity;
+    }
+    table = (tGuestTable*) malloc(sizeof(tGuestTable));
+    if(table == NULL) {
+        return NULL;
+    }
+    guestTable_init(table);
+    object->guestTables[object->guestTablesCount] = table;
+    object->guestTablesCount++;
+    
+    return table;
+}
+
+// Compare the addresses of two guest tables, to sort them
+static int congress_compareGuestTables(const void* a, const void* b) {
+    const tGuestTable* table1 = *(const tGuestTable* const*) a;
+    const tGuestTable* table2 = *(const tGuestTable* const*) b;
+    
+    return (table1 > table2) - (table1 < table2);
+}
+
+// Get guests all gests of a congress
 tError congress_getGuests(tCongress* object, tGuestTable* guests) {
     // PR1 EX4
 
     assert(object != NULL);
     assert(guests != NULL);    
 
-    int i, j;
+    tGuestTable **tables, *table, **found;
+    bool *visited;
+    unsigned int i, count, total;
     tError error;
     error = OK;    
 
+    if (object->organizations->size == 0) {
+        return OK;
+    }
+    
+    // Organizations often share the same table of guests. The tables are sorted by address, so each one is visited once.
+    tables = (tGuestTable**) malloc(object->organizations->size * sizeof(tGuestTable*));
+    visited = (bool*) calloc(object->organizations->size, sizeof(bool));
+    if (tables == NULL || visited == NULL) {
+        free(tables);
+        free(visited);
+        return ERR_MEMORY_ERROR;
+    }
     for (i=0; i<object->organizations->size; i++) {
-        for (j=0; j<object->organizations->elements[i].guests->size; j++) {
-            error = guestTable_add(guests, &(object->organizations->elements[i].guests->elements[j]));
+        tables[i] = object->organizations->elements[i].guests;
+    }
+    qsort(tables, object->organizations->size, sizeof(tGuestTable*), congress_compareGuestTables);
+    
+    // The output table is allocated once for all the guests of the different tables
+    count = 0;
+    total = 0;
+    for (i=0; i<object->organizations->size; i++) {
+        if (i == 0 || tables[i] != tables[count - 1]) {
+            tables[count] = tables[i];
+            total += tables[i]->size;
+            count++;
+        }
+    }
+    error = guestTable_reserve(guests, guests->size + total);
+    
+    // The guests are added in the order of the organizations. Repeated guests are found on the index of the output table and skipped.
+    for (i=0; error == OK && i<object->organizations->size; i++) {
+        table = object->organizations->elements[i].guests;
+        found = (tGuestTable**) bsearch(&table, tables, count, sizeof(tGuestTable*), congress_compareGuestTables);
+        assert(found != NULL);
+        if (!visited[found - tables]) {
+            visited[found - tables] = true;
+            error = guestTable_addMany(guests, table->elements, table->size);
+            if (error == ERR_DUPLICATED) {
+                error = OK;
+            }
         }
-    }   
+    }
+    
+    free(tables);
+    free(visited);
     return error;
 }
 
 
+/**************	Index again all the presentations by organization	*******************/
+static tError congress_indexPresentations(tCongress* object) {
+	tPresentationQueueIterator it;
+	tPresentation *p;
+	
+	presentationIndex_clear(&object->byOrganization);
+	for(presentationQueue_begin(&object->presentations, &it); (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)){
+		if(presentationIndex_add(&object->byOrganization, p->organizationId, p) != OK){
+			return ERR_MEMORY_ERROR;
+		}
+	}
+	return OK;
+}
+
+
+/**************	Store a new presentation of a registered organization, with its interned name. The strings are copied, or shared when they are already on the arena.	*******************/
+static tError congress_storePresentation(tCongress* object, tOrganization *organization, unsigned int organizationId, double score, const char* presentationTitle, const char* presentationTopic, bool copy) {
+	tPresentation presentation;
+	tPresentation *elements;
+	tError err;
+	
+	//fill the presentation with the input parameters. The topic and the organization name are interned, so all the presentations share the same copy.
+	presentation.topicId = copy ? internTable_add(&object->names, presentationTopic) : internTable_addShared(&object->names, presentationTopic);
+	presentation.organizationId = organizationId;
+	if(presentation.topicId == INTERN_NO_ID){
+		return ERR_MEMORY_ERROR;
+	}
+	presentation.presentationTopic = (char*) internTable_get(&object->names, presentation.topicId);
+	//the stored presentation takes a reference to the name of the registered organization, which is kept after the organization is removed
+	presentation.organization = *organization;
+	presentation.score = score;
+	//The queue copies the title on the arena of the congress, so it is not copied here.
+	presentation.presentationTitle = (char*) presentationTitle;
+	//and enqueue the presentation in the queue presentations
+	elements = object->presentations.elements;
+	err = copy ? presentationQueue_enqueue(&(object->presentations), presentation) : presentationQueue_enqueueShared(&(object->presentations), presentation);
+	if(err != OK){
+		return ERR_MEMORY_ERROR;
+	}
+	//the index points to the stored presentations. If a ring queue moves them to a larger array, all of them are indexed again.
+	if(object->presentations.type == PRESENTATION_QUEUE_RING && object->presentations.elements != elements){
+		err = congress_indexPresentations(object);
+	} else {
+		err = presentationIndex_add(&object->byOrganization, presentation.organizationId, presentationQueue_last(object->presentations));
+	}
+	if(err != OK){
+		return err;
+	}
+	//finally the best scores of the topic are updated
+	return ranking_add(&object->ranking, presentation.topicId, presentation.organizationId, score);
+}
+
+
 /**************	Add a new presentation	*******************/
 tError congress_addPresentation(tCongress* object, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic) {
     // PR2 EX1
     //return ERR_NOT_IMPLEMENTED;
 	
-	tOrganization *organization;
-	tPresentation presentation;
+	int pos;
 	
-	organization = congress_findOrganization(object, organization_name);
-	if(organization == NULL){
+	pos = congress_findPosition(object, organization_name, hash_string(organization_name));
+	if(pos < 0){
 		return ERR_INVALID_ORGANIZATION; //if the organization isn't found in congress return the error
 	}
-	// else initialize the presentation with the input parameters
-	presentation_init(&presentation, organization, score, presentationTitle, presentationTopic);
-	//and enqueue the presentation in the queue presentations
-	return presentationQueue_enqueue(&(object->presentations), presentation);
+	return congress_storePresentation(object, &(object->organizations->elements[pos]), object->organizationIds[pos], score, presentationTitle, presentationTopic, true);
+}
+
+
+/**************	Add many presentations at once, copying their strings or sharing them	*******************/
+static unsigned int congress_insertPresentations(tCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors, bool copy) {
+	tPresentation *elements;
+	tError err;
+	unsigned int i, added;
+	int pos;
+	
+	//Check preconditions
+	assert(object != NULL);
+	assert(presentations != NULL || count == 0);
+	
+	//the storage of the presentations is allocated once. A ring queue moved to a larger array is indexed again.
+	elements = object->presentations.elements;
+	err = presentationQueue_reserve(&object->presentations, count);
+	if(err == OK && object->presentations.type == PRESENTATION_QUEUE_RING && object->presentations.elements != elements){
+		err = congress_indexPresentations(object);
+	}
+	
+	//the organizations are found on the index of the congress, which keeps the interned identifiers of their names
+	added = 0;
+	for(i=0; i<count; i++){
+		if(err == OK){
+			assert(presentations[i].organizationName != NULL);
+			pos = congress_findPosition(object, presentations[i].organizationName, hash_string(presentations[i].organizationName));
+			if(pos < 0){
+				//the other presentations are added anyway
+				if(errors != NULL){
+					errors[i] = ERR_INVALID_ORGANIZATION;
+				}
+				continue;
+			}
+			err = congress_storePresentation(object, &(object->organizations->elements[pos]), object->organizationIds[pos], presentations[i].score, presentations[i].title, presentations[i].topic, copy);
+			if(err == OK){
+				added++;
+			}
+		}
+		//after a memory error, the remaining presentations are not added
+		if(errors != NULL){
+			errors[i] = err;
+		}
+	}
+	
+	return added;
+}
+
+
+/**************	Add many presentations at once	*******************/
+unsigned int congress_addPresentationsBatch(tCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors) {
+	return congress_insertPresentations(object, presentations, count, errors, true);
+}
+
+
+/**************	Add many presentations at once, sharing their strings	*******************/
+unsigned int congress_addPresentationsBatchShared(tCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors) {
+	return congress_insertPresentations(object, presentations, count, errors, false);
 }
 
 
@@ -139,59 +432,26 @@ int congress_getOrganizationWins(tCongress* object, const char* organization_nam
 	assert(organization_name != NULL);
 	assert(topic != NULL);
 		
-	tPresentation p1, p2;
 	tOrganization *organization;
-	tPresentationQueue presentations;
-	
-	p1.presentationTopic = "empty";
-	p2.presentationTopic = "empty"; //Presentation are empty.
+	unsigned int topicId;
 	
 	organization = congress_findOrganization(object, organization_name);
 	if(organization == NULL){
 		return ERR_NOT_EXISTS; //if the organization isn't found return the error.
 	}
 	
-	//the queue is duplicated to work with the copy
-	presentationQueue_duplicate(&presentations, object->presentations);
-	
-	while(!presentationQueue_empty(presentations)){
-		tPresentation *pTemp;
-		pTemp = presentationQueue_head(presentations);
-		
-		// if the variable presentationTopic and organization's name of the element on the head of the duplicated queue match
-		if(strcmp(pTemp->presentationTopic, topic) == 0){
-			if(strcmp(pTemp->organization.name, organization_name) == 0){
-				//the presentation from the element on the head of the queue is pointed by p1
-				presentation_duplicate(&p1, *pTemp);
-				//the element on the head of the queue is deleted
-				presentationQueue_dequeue(&presentations);
-				continue;
-			} else {
-				if(pTemp->score > p2.score){		//if score of the element of the head is bigger than the score of p2
-					presentation_duplicate(&p2, *pTemp); //the element pTemp is duplicated(or overwritten) to the variable p2
-				} 
-			}
-		}
-		//in any other case the element on the head is deleted
-		presentationQueue_dequeue(&presentations);
-	}
-	//the results are compared and a value is returned for every case.
-	if(strcmp(p1.presentationTopic, "empty") != 0 || strcmp(p2.presentationTopic, "empty") != 0){
-		if(p1.score > p2.score){
-			return 3;
-		}
-		if(p1.score == p2.score){
-			return 1;
-		} else {
-			return 0; // p1.score is smaller than p2.score
-		}
-	} else {
+	//the topic is searched on the intern table
+	topicId = internTable_find(&object->names, topic);
+	if(topicId == INTERN_NO_ID){
 		return ERR_NOT_EXISTS; // Topic not found.
 	}
+	
+	//the ranking keeps the best scores of each topic, updated with each new presentation, so the queue is not walked
+	return ranking_getWins(&object->ranking, topicId, internTable_find(&object->names, organization_name));
 } 
 
 
-/***************	Get the average score for an organization	*******************/
+/***************	Get the total score for an organization	*******************/
 double congress_getOrganizationScore(tCongress* object, const char* organization_name) {
     // PR2 EX3
 	//return ERR_NOT_IMPLEMENTED;
@@ -200,17 +460,48 @@ double congress_getOrganizationScore(tCongress* object, const char* organization
     assert(object != NULL);
 	assert(organization_name != NULL);
 	
-	double result = 0; //we initialize the variable result to 0
+	tScoreStats stats;
 	
-	tOrganization *org;
-	org = congress_findOrganization(object, organization_name); //the organization is searched
-	if(org != NULL){ //if the organization is found
-		//the recursive function is called und the value is saved in result
-		result = presentationQueue_getOrganizationScoreRecursive(&(object->presentations), org);
-	} else {
-		result = 0; //if the organization isn't found is saved the value 0 in the variable result
+	//the aggregates are updated with each new presentation, so the queue is not walked. Unknown organizations have a score of 0.
+	if(congress_getOrganizationStats(object, organization_name, &stats) != OK){
+		return 0;
+	}
+	return stats.sum;
+}
+
+
+/***************	Get the average score for an organization	*******************/
+double congress_getOrganizationAverage(tCongress* object, const char* organization_name) {
+	
+	//Check preconditions
+	assert(object != NULL);
+	assert(organization_name != NULL);
+	
+	tScoreStats stats;
+	
+	if(congress_getOrganizationStats(object, organization_name, &stats) != OK || stats.count == 0){
+		return 0;
+	}
+	return stats.sum / stats.count;
+}
+
+
+/***************	Get the aggregates of the scores of an organization	*******************/
+tError congress_getOrganizationStats(tCongress* object, const char* organization_name, tScoreStats* stats) {
+	
+	//Check preconditions
+	assert(object != NULL);
+	assert(organization_name != NULL);
+	assert(stats != NULL);
+	
+	if(congress_findOrganization(object, organization_name) == NULL){
+		memset(stats, 0, sizeof(tScoreStats));
+		return ERR_NOT_EXISTS; //if the organization isn't found return the error.
 	}
-	return result;
+	
+	//the organizations without presentations get empty aggregates
+	ranking_getStats(&object->ranking, internTable_find(&object->names, organization_name), stats);
+	return OK;
 }
 
 
@@ -224,12 +515,37 @@ tError congress_getOrganizationPresentations(tCongress* object, const char* orga
 	assert(organization_name != NULL);
 	assert(presentations != NULL);
 	
-	tOrganization *org;
-	org = congress_findOrganization(object, organization_name); //the organization is searched
-	if(org == NULL){	//if the organization isn't found
-		return ERR_INVALID_ORGANIZATION;
+	tPresentationView view;
+	tError err;
+	unsigned int i;
+	
+	err = congress_getOrganizationPresentationsView(object, organization_name, &view);
+	if(err != OK){	//if the organization isn't found
+		return err;
+	}
+	//only the presentations of the organization are copied, instead of walking all the presentations of the congress
+	for(i=0; i<presentationView_size(view); i++){
+		err = presentationQueue_enqueue(presentations, *presentationView_get(view, i));
+		if(err != OK){
+			return err;
+		}
 	}
-	//the recursive function is called with the parameters presentations of congres, the organization und the destination queue
-	return presentationQueue_getOrganizationPresentationsRecursive(&(object->presentations), org, presentations);
+	return OK;
+}
+
+
+/***************	Get a view of all the presentations for an organization	*******************/
+tError congress_getOrganizationPresentationsView(tCongress* object, const char* organization_name, tPresentationView* view) {
 	
+	//Check preconditions
+	assert(object != NULL);
+	assert(organization_name != NULL);
+	assert(view != NULL);
+	
+	if(congress_findOrganization(object, organization_name) == NULL){	//if the organization isn't found
+		return ERR_INVALID_ORGANIZATION;
+	}
+	//the organizations without presentations get an empty view
+	presentationIndex_getView(&object->byOrganization, internTable_find(&object->names, organization_name), view);
+	return OK;
 }
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "exporter.h"
+
+// Buffered writer of an export
+typedef struct {
+    FILE* output;
+    char* buffer;
+    size_t used;
+    // First error found. Nothing else is written after an error.
+    tError err;
+} tExportWriter;
+
+// Write the content of the buffer to the output
+static void exporter_flush(tExportWriter* writer) {
+    if(writer->used > 0 && writer->err == OK && fwrite(writer->buffer, 1, writer->used, writer->output) != writer->used) {
+        writer->err = ERR_CANNOT_WRITE;
+    }
+    writer->used = 0;
+}
+
+// Write some bytes. Blocks that do not fit on an empty buffer are written directly.
+static void exporter_write(tExportWriter* writer, const char* data, size_t length) {
+    if(writer->used + length > EXPORTER_BUFFER_SIZE) {
+        exporter_flush(writer);
+        if(length >= EXPORTER_BUFFER_SIZE) {
+            if(writer->err == OK && fwrite(data, 1, length, writer->output) != length) {
+                writer->err = ERR_CANNOT_WRITE;
+            }
+            return;
+        }
+    }
+    memcpy(writer->buffer + writer->used, data, length);
+    writer->used += length;
+}
+
+// Write a text
+static void exporter_text(tExportWriter* writer, const char* text) {
+    exporter_write(writer, text, strlen(text));
+}
+
+// Write a string as a JSON string. The characters that need no escape are written in blocks.
+static void exporter_string(tExportWriter* writer, const char* str) {
+    char escape[8];
+    size_t length;
+
+    exporter_write(writer, "\"", 1);
+    while(*str != '\0') {
+        length = 0;
+        while(str[length] != '\0' && str[length] != '"' && str[length] != '\\' && (unsigned char) str[length] >= 0x20) {
+            length++;
+        }
+        exporter_write(writer, str, length);
+        str += length;
+        if(*str == '\0') {
+            break;
+        }
+
+        switch(*str) {
+            case '"':
+                exporter_write(writer, "\\\"", 2);
+                break;
+            case '\\':
+                exporter_write(writer, "\\\\", 2);
+                break;
+            case '\n':
+                exporter_write(writer, "\\n", 2);
+                break;
+            case '\r':
+                exporter_write(writer, "\\r", 2);
+                break;
+            case '\t':
+                exporter_write(writer, "\\t", 2);
+                break;
+            default:
+                sprintf(escape, "\\u%04x", (unsigned char) *str);
+                exporter_write(writer, escape, 6);
+                break;
+        }
+        str++;
+    }
+    exporter_write(writer, "\"", 1);
+}
+
+// Write a number. The shortest form that reads back as the same value is used, and values that JSON cannot represent are written as null.
+static void exporter_number(tExportWriter* writer, double value) {
+    char number[32];
+
+    if(value != value || value - value != 0) {
+        exporter_write(writer, "null", 4);
+        return;
+    }
+    sprintf(number, "%.15g", value);
+    if(strtod(number, NULL) != value) {
+        sprintf(number, "%.17g", value);
+    }
+    exporter_text(writer, number);
+}
+
+// Write a field name, preceded by a comma if it is not the first one
+static void exporter_key(tExportWriter* writer, const char* key, bool first) {
+    if(!first) {
+        exporter_write(writer, ",", 1);
+    }
+    exporter_string(writer, key);
+    exporter_write(writer, ":", 1);
+}
+
+// Write an organization, with its guests and the aggregates of its presentations
+static void exporter_organization(tExportWriter* writer, tCongress* object, tOrganization* organization) {
+    tScoreStats stats;
+    tRankingTopicIterator it;
+    tGuest* guest;
+    unsigned int i, organizationId, topicId;
+    bool first;
+
+    exporter_write(writer, "{", 1);
+    exporter_key(writer, "name", true);
+    exporter_string(writer, organization->name);
+
+    exporter_key(writer, "guests", false);
+    exporter_write(writer, "[", 1);
+    for(i=0; i<organization->guests->size; i++) {
+        guest = &(organization->guests->elements[i]);
+        if(i > 0) {
+            exporter_write(writer, ",", 1);
+        }
+        exporter_write(writer, "{", 1);
+        exporter_key(writer, "username", true);
+        exporter_string(writer, guest->username);
+        exporter_key(writer, "name", false);
+        exporter_string(writer, guest->name);
+        exporter_key(writer, "mail", false);
+        exporter_string(writer, guest->mail);
+        exporter_write(writer, "}", 1);
+    }
+    exporter_write(writer, "]", 1);
+
+    // The aggregates are taken from the ranking, without walking the presentations
+    organizationId = internTable_find(&object->names, organization->name);
+    if(organizationId == INTERN_NO_ID || !ranking_getStats(&object->ranking, organizationId, &stats)) {
+        memset(&stats, 0, sizeof(tScoreStats));
+    }
+    exporter_key(writer, "presentations", false);
+    exporter_number(writer, stats.count);
+    exporter_key(writer, "score", false);
+    exporter_number(writer, stats.sum);
+    exporter_key(writer, "average", false);
+    exporter_number(writer, (stats.count > 0) ? stats.sum / stats.count : 0);
+
+    // The ranking keeps the topics where each organization has presentations, so the other topics are not visited
+    exporter_key(writer, "wins", false);
+    exporter_write(writer, "{", 1);
+    first = true;
+    for(ranking_beginTopics(&object->ranking, organizationId, &it); (topicId = ranking_getTopic(&it)) != 0; ranking_nextTopic(&it)) {
+        exporter_key(writer, internTable_get(&object->names, topicId), first);
+        exporter_number(writer, ranking_getWins(&object->ranking, topicId, organizationId));
+        first = false;
+    }
+    exporter_write(writer, "}}", 2);
+}
+
+// Write the congress to a stream as a JSON object, with its organizations, their guests, scores and wins by topic, and its presentations.
+// The memory used does not depend on the size of the congress. Returns ERR_CANNOT_WRITE if the stream cannot be written.
+tError congress_export(tCongress* object, FILE* output) {
+    tExportWriter writer;
+    tPresentationQueueIterator it;
+    tPresentation* p;
+    unsigned int i;
+    bool first;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(output != NULL);
+
+    writer.output = output;
+    writer.used = 0;
+    writer.err = OK;
+    writer.buffer = (char*) malloc(EXPORTER_BUFFER_SIZE);
+    if(writer.buffer == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    exporter_write(&writer, "{", 1);
+    exporter_key(&writer, "name", true);
+    exporter_string(&writer, object->name);
+
+    // Each element goes on its own line
+    exporter_key(&writer, "organizations", false);
+    exporter_write(&writer, "[", 1);
+    for(i=0; writer.err == OK && i<object->organizations->size; i++) {
+        exporter_write(&writer, (i > 0) ? ",\n" : "\n", (i > 0) ? 2 : 1);
+        exporter_organization(&writer, object, &(object->organizations->elements[i]));
+    }
+    exporter_write(&writer, "]", 1);
+
+    exporter_key(&writer, "presentations", false);
+    exporter_write(&writer, "[", 1);
+    first = true;
+    for(presentationQueue_begin(&object->presentations, &it); writer.err == OK && (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        exporter_write(&writer, first ? "\n" : ",\n", first ? 1 : 2);
+        exporter_write(&writer, "{", 1);
+        exporter_key(&writer, "organization", true);
+        exporter_string(&writer, p->organization.name);
+        exporter_key(&writer, "title", false);
+        exporter_string(&writer, p->presentationTitle);
+        exporter_key(&writer, "topic", false);
+        exporter_string(&writer, p->presentationTopic);
+        exporter_key(&writer, "score", false);
+        exporter_number(&writer, p->score);
+        exporter_write(&writer, "}", 1);
+        first = false;
+    }
+    exporter_write(&writer, "]}\n", 3);
+
+    exporter_flush(&writer);
+    free(writer.buffer);
+    if(writer.err == OK && fflush(output) != 0) {
+        writer.err = ERR_CANNOT_WRITE;
+    }
+
+    return writer.err;
+}
@@ -36,6 +36,34 @@ tError guest_init(tGuest* object, const char* username, const char* name, const
     return OK;    
 }
 
+// Initialize the guest structure, taking the memory of the fields from an arena. The guest is released with the arena, not with guest_free.
+tError guest_initArena(tGuest* object, tArena* arena, const char* username, const char* name, const char* mail) {
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(arena != NULL);
+    assert(username != NULL);
+    assert(name != NULL);
+    assert(mail != NULL);
+    
+    // Check that the mail have the correct format
+    if(!check_mail(mail)) {
+        return ERR_INVALID;
+    }
+    
+    // The arena allocates and copies the strings
+    object->username = arena_strdup(arena, username);
+    object->name = arena_strdup(arena, name);
+    object->mail = arena_strdup(arena, mail);
+    
+    // Check that memory has been allocated for all fields
+    if(object->username == NULL || object->name == NULL || object->mail == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    return OK;
+}
+
 // Remove the memory used by guest structure
 void guest_free(tGuest* object) {
     
@@ -92,16 +120,33 @@ bool guestTable_equals(tGuestTable* guestTable1, tGuestTable* guestTable2){
     assert(guestTable1 != NULL);
     assert(guestTable2 != NULL);
 
-    int i;
-    if(guestTable1->size != guestTable2->size){
+    unsigned int i, j, first;
+    if(guestTable1 == guestTable2){
+      return true;
+    }
+    // The tables with different number of guests or different content hash cannot be equal
+    if(guestTable1->size != guestTable2->size || guestTable1->contentHash != guestTable2->contentHash){
       return false;
     }
 
-    for(i=0; i< guestTable1->size;i++)
+    // Copies of a table usually have the guests in the same order, so they are compared position by position while they match
+    first = 0;
+    while(first < guestTable1->size && strcmp(guestTable1->elements[first].username, guestTable2->elements[first].username) == 0) {
+        first++;
+    }
+
+    // The usernames are unique, so the remaining guests of both tables must be the same ones in a different order
+    for(i=first; i< guestTable2->size;i++)
     {
-        // Uses "find" because the order of guests could be different
-        if(!guestTable_find(guestTable1, guestTable2->elements[i].username)) {
-            // Usernames are different
+        if(guestTable2->size - first < GUEST_TABLE_EQUALS_SCAN_THRESHOLD) {
+            // A few guests are compared directly, which is cheaper than hashing their usernames
+            for(j=first; j<guestTable1->size && strcmp(guestTable1->elements[j].username, guestTable2->elements[i].username) != 0; j++);
+            if(j == guestTable1->size) {
+                // Usernames are different
+                return false;
+            }
+        } else if(!guestTable_find(guestTable1, guestTable2->elements[i].username)) {
+            // Uses "find" because the order of guests could be different
             return false;
         }
     }
@@ -134,6 +179,67 @@ void guestTable_init(tGuestTable* table) {
     table->size = 0;
     // Using dynamic memory, the pointer to the elements must be set to NULL (no memory allocated). This is the main difference with respect to the user of static memory, were data was allways initialized (tGuest elements[MAX_ELEMENTS])
     table->elements = NULL;
+    table->capacity = 0;
+    // The index is also empty
+    hashIndex_init(&(table->index));
+    table->contentHash = 0;
+    table->shared = false;
+}
+
+// Get the contribution of a username to the content hash of a table. The contributions are added, so the order of the guests does not matter.
+static unsigned int guestTable_contentHash(unsigned int hash) {
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    return hash ^ (hash >> 16);
+}
+
+// Get the key used by the hash index for the element on a position of the table
+static const char* guestTable_getKey(const void* table, unsigned int position) {
+    return ((const tGuestTable*) table)->elements[position].username;
+}
+
+// Modify the memory used by the table to store capacity elements
+static tError guestTable_setCapacity(tGuestTable* table, unsigned int capacity) {
+    tGuest* elements;
+    
+    assert(capacity >= table->size);
+    
+    // We cannot allocate zero bytes. An empty capacity releases the memory.
+    if(capacity == 0) {
+        if(table->elements != NULL) {
+            free(table->elements);
+            table->elements = NULL;
+        }
+        table->capacity = 0;
+        return OK;
+    }
+    
+    // realloc behaves as malloc when there is no previous memory block (NULL pointer). We keep the previous block if it fails.
+    elements = (tGuest*) realloc(table->elements, capacity * sizeof(tGuest));
+    if(elements == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    table->elements = elements;
+    table->capacity = capacity;
+    
+    return OK;
+}
+
+// Allocate memory for at least capacity elements
+tError guestTable_reserve(tGuestTable* table, unsigned int capacity) {
+    // Verify pre conditions
+    assert(table != NULL);
+    
+    // The index is also prepared for the same number of elements
+    if(hashIndex_reserve(&(table->index), capacity) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    // The memory is never reduced by this method
+    if(capacity <= table->capacity) {
+        return OK;
+    }
+    
+    return guestTable_setCapacity(table, capacity);
 }
 
 // Remove the memory used by guestTable structure
@@ -146,12 +252,19 @@ void guestTable_free(tGuestTable* object) {
         free(object->elements);
         object->elements = NULL;
     }
-    // As the table is now empty, assign the size to 0.
+    // As the table is now empty, assign the size and the capacity to 0.
     object->size = 0;
+    object->capacity = 0;
+    object->contentHash = 0;
+    object->shared = false;
+    // Remove the index of the elements
+    hashIndex_free(&(object->index));
 }
 
 // Add a new guest to the table
 tError guestTable_add(tGuestTable* table, tGuest* guest) {
+    unsigned int hash;
+    
     // Verify pre conditions
     assert(table != NULL);
     assert(guest != NULL);
@@ -160,102 +273,187 @@ tError guestTable_add(tGuestTable* table, tGuest* guest) {
     if (guestTable_find(table, guest->username))
         return ERR_DUPLICATED;
         
-    // The first step is to allocate the required space. There are two methods to manage the memory (malloc and realloc). Malloc allows to allocate a new memory block, while realloc allows to modify an existing memory block.    
-    if(table->size == 0) {
-        // Empty table
-        
-        // Increase the number of elements of the table
-        table->size = 1;
-        
-        // Since the table is empty, and we do not have any previous memory block, we have to use malloc. The amount of memory we need is the number of elements (will be 1) times the size of one element, which is computed by sizeof(type). In this case the type is tGuest.
-        table->elements = (tGuest*) malloc(table->size * sizeof(tGuest));        
-    } else {
-        // table with elements
-        
-        // Increase the number of elements of the table
-        table->size = table->size + 1 ;
-        
-        // Since the table is not empty, we already have a memory block. We need to modify the size of this block, using the realloc command. The amount of memory we need is the number of elements times the size of one element, which is computed by sizeof(type). In this case the type is tGuest. We provide the previous block of memory.
-        table->elements = (tGuest*) realloc(table->elements, table->size * sizeof(tGuest));         
+    // The first step is to make sure there is space for a new element. When the allocated memory is full, its capacity is doubled, so the number of reallocations is logarithmic on the number of elements.
+    if(table->size == table->capacity) {
+        if(guestTable_setCapacity(table, table->capacity == 0 ? GUEST_TABLE_MIN_CAPACITY : table->capacity * 2) != OK) {
+            // Error allocating or reallocating the memory
+            return ERR_MEMORY_ERROR;
+        }
     }
     
-    // Check that the memory has been allocated
-    if(table->elements == NULL) {
-        // Error allocating or reallocating the memory
-        return ERR_MEMORY_ERROR;
-    }
+    // Increase the number of elements of the table
+    table->size = table->size + 1;
     
     // Once we have the block of memory, which is an array of tGuest elements, we initialize the new element (which is the last one). The last element is " table->elements[table->size - 1] " (we start counting at 0)
     guest_init(&(table->elements[table->size - 1]), guest->username, guest->name, guest->mail);
     
+    // Add the new element to the index and to the content hash
+    hash = hash_string(guest->username);
+    table->contentHash += guestTable_contentHash(hash);
+    return hashIndex_insert(&(table->index), hash, table->size - 1);
+}
+
+// Add many guests at the end of the table, copying their fields or sharing them
+static tError guestTable_insertMany(tGuestTable* table, tGuest* guests, unsigned int count, bool copy) {
+    tError err, errGuest;
+    unsigned int i, hash;
+    
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(guests != NULL || count == 0);
+    
+    // The memory of the table and of its index is allocated once for all the guests
+    if(guestTable_reserve(table, table->size + count) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    err = OK;
+    for(i=0; i<count; i++) {
+        // Each guest is indexed as soon as it is added, so the index also finds the guests repeated on the array
+        hash = hash_string(guests[i].username);
+        if(hashIndex_find(&(table->index), guests[i].username, hash, guestTable_getKey, table) >= 0) {
+            err = ERR_DUPLICATED;
+            continue;
+        }
+        
+        // The new elements are initialized one after the other at the end of the table. Guests with an invalid mail are skipped.
+        if(copy) {
+            errGuest = guest_init(&(table->elements[table->size]), guests[i].username, guests[i].name, guests[i].mail);
+        } else if(check_mail(guests[i].mail)) {
+            table->elements[table->size] = guests[i];
+            errGuest = OK;
+        } else {
+            errGuest = ERR_INVALID;
+        }
+        if(errGuest == ERR_INVALID) {
+            err = ERR_INVALID;
+            continue;
+        } else if(errGuest != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+        table->size = table->size + 1;
+        table->contentHash += guestTable_contentHash(hash);
+        if(hashIndex_insert(&(table->index), hash, table->size - 1) != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+    }
+    
+    return err;
+}
+
+// Add many guests to the table. Guests already on the table or repeated on the array are skipped, and ERR_DUPLICATED is returned. Guests with an invalid mail are skipped too, returning ERR_INVALID.
+tError guestTable_addMany(tGuestTable* table, tGuest* guests, unsigned int count) {
+    return guestTable_insertMany(table, guests, count, true);
+}
+
+// Add many guests to the table without copying their fields, which must be kept while the table is used. The guests are skipped as in guestTable_addMany.
+tError guestTable_addManyShared(tGuestTable* table, tGuest* guests, unsigned int count) {
+    // Verify pre conditions
+    assert(table != NULL);
+    
+    table->shared = true;
+    return guestTable_insertMany(table, guests, count, false);
+}
+
+// Reduce the memory used by the table after an element is removed
+static tError guestTable_shrink(tGuestTable* table) {
+    // If we removed the last element, we release the memory. Otherwise, the memory is halved when only a quarter of it is used, so consecutive adds and removes do not reallocate it each time.
+    if (table->size == 0) {
+        return guestTable_setCapacity(table, 0);
+    } else if (table->size <= table->capacity / 4 && table->capacity > GUEST_TABLE_MIN_CAPACITY) {
+        return guestTable_setCapacity(table, table->capacity / 2);
+    }
+    
     return OK;
 }
 
-// Remove a guest from the table
+// Remove a guest from the table, keeping the order of the other guests
 tError guestTable_remove(tGuestTable* table, tGuest* guest) {
-    int i;
-    bool found;
+    int pos;
+    unsigned int hash;
     
     // Verify pre conditions
     assert(table != NULL);
     assert(guest != NULL);
     
-    // To remove an element of a table, we will move all elements after this element one position, to fill the space of the removed element.
-    found = false;
-    for(i=0; i<table->size; i++) {
-        // If the element has been found. Displace this element to the previous element (will never happend for the first one). We use the ADDRESS of the previous element &(table->elements[i-1]) as destination, and ADDRESS of the current element &(table->elements[i]) as source.
-        if(found) {
-            // Check the return code to detect memory allocation errors
-            if(guest_cpy(&(table->elements[i-1]), &(table->elements[i])) == ERR_MEMORY_ERROR) {
-                // Error allocating memory. Just stop the process and return memory error.
-                return ERR_MEMORY_ERROR;
-            }
-        } else if(strcmp(table->elements[i].username, guest->username) == 0) {
-            // The current element is the element we want to remove. Set found flag to true to start element movement.
-            found = true;
-        }
-    }    
+    // Get the position of the element using the index
+    hash = hash_string(guest->username);
+    pos = hashIndex_find(&(table->index), guest->username, hash, guestTable_getKey, table);
+    if(pos < 0) {
+        // If the element was not in the table, return an error.
+        return ERR_NOT_FOUND;
+    }
     
-    // Once removed the element, we need to modify the memory used by the table.
-    if(found) {
-        // Modify the number of elements
-        table->size = table->size - 1;
-        
-        // If we are removing the last element, we will assign the pointer to NULL, since we cannot allocate zero bytes
-        if (table->size == 0) {
-            table->elements = NULL;
-        } else {                
-            // Modify the used memory. As we are modifying a previously allocated block, we need to use the realloc command.
-            table->elements = (tGuest*) realloc(table->elements, table->size * sizeof(tGuest));
-            
-            // Check that the memory has been allocated
-            if(table->elements == NULL) {
-                // Error allocating or reallocating the memory
-                return ERR_MEMORY_ERROR;
-            }        
-        }
-    } else {
+    // The removed element is not indexed anymore, and the elements after it will be one position before
+    hashIndex_remove(&(table->index), hash, pos);
+    hashIndex_shift(&(table->index), pos);
+    table->contentHash -= guestTable_contentHash(hash);
+    
+    // Release the fields of the removed element, unless they are shared with their owner
+    if(!table->shared) {
+        guest_free(&(table->elements[pos]));
+    }
+    
+    // To remove an element of a table, we move all elements after this element one position, to fill the space of the removed element. The fields of the guests are pointers owned by the table, so moving the structures is enough and nothing needs to be copied or allocated.
+    memmove(&(table->elements[pos]), &(table->elements[pos + 1]), (table->size - pos - 1) * sizeof(tGuest));
+    
+    // Modify the number of elements and the used memory
+    table->size = table->size - 1;
+    
+    return guestTable_shrink(table);
+}
+
+// Remove a guest from the table in constant time. The last guest of the table takes its position.
+tError guestTable_removeUnordered(tGuestTable* table, tGuest* guest) {
+    int found;
+    unsigned int hash, pos, last;
+    
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(guest != NULL);
+    
+    // Get the position of the element using the index
+    hash = hash_string(guest->username);
+    found = hashIndex_find(&(table->index), guest->username, hash, guestTable_getKey, table);
+    if(found < 0) {
         // If the element was not in the table, return an error.
         return ERR_NOT_FOUND;
-    }         
+    }
+    pos = (unsigned int) found;
     
-    return OK;
+    // Release the fields of the removed element, unless they are shared, and remove it from the index
+    hashIndex_remove(&(table->index), hash, pos);
+    table->contentHash -= guestTable_contentHash(hash);
+    if(!table->shared) {
+        guest_free(&(table->elements[pos]));
+    }
+    
+    // Move the last element to the free position, unless the removed element was the last one
+    last = table->size - 1;
+    if(pos != last) {
+        table->elements[pos] = table->elements[last];
+        hashIndex_update(&(table->index), hash_string(table->elements[pos].username), last, pos);
+    }
+    
+    // Modify the number of elements and the used memory
+    table->size = table->size - 1;
+    
+    return guestTable_shrink(table);
 }
 
 // Get guest by username
 tGuest* guestTable_find(tGuestTable* table, const char* username) {
-    int i;
+    int pos;
     
     // Verify pre conditions
     assert(table != NULL);
     assert(username != NULL);
     
-    // Search over the table and return once we found the element.
-    for(i=0; i<table->size; i++) {
-        if(strcmp(table->elements[i].username, username) == 0) {
-            // We return the ADDRESS (&) of the element, which is a pointer to the element
-            return &(table->elements[i]);
-        }
+    // Search the position of the element on the index, instead of comparing with all the elements of the table.
+    pos = hashIndex_find(&(table->index), username, hash_string(username), guestTable_getKey, table);
+    if(pos >= 0) {
+        // We return the ADDRESS (&) of the element, which is a pointer to the element
+        return &(table->elements[pos]);
     }
     
     // The element has not been found. Return NULL (empty pointer).
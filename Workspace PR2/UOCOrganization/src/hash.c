@@ -0,0 +1,233 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "hash.h"
+
+// Compute the hash value of a string
+unsigned int hash_string(const char* str) {
+    unsigned int hash;
+
+    // Verify pre conditions
+    assert(str != NULL);
+
+    // FNV-1a hash. Each char is mixed with the current value and multiplied by the FNV prime.
+    hash = 2166136261u;
+    while(*str != '\0') {
+        hash ^= (unsigned char) *str;
+        hash *= 16777619u;
+        str++;
+    }
+
+    return hash;
+}
+
+// Initialize the hash index
+void hashIndex_init(tHashIndex* index) {
+    // Verify pre conditions
+    assert(index != NULL);
+
+    // An empty index has no slots. They are allocated with the first insertion.
+    index->capacity = 0;
+    index->count = 0;
+    index->slots = NULL;
+}
+
+// Remove the memory used by the hash index
+void hashIndex_free(tHashIndex* index) {
+    // Verify pre conditions
+    assert(index != NULL);
+
+    if(index->slots != NULL) {
+        free(index->slots);
+        index->slots = NULL;
+    }
+    index->capacity = 0;
+    index->count = 0;
+}
+
+// Remove all the entries of the hash index, keeping the allocated slots
+void hashIndex_clear(tHashIndex* index) {
+    // Verify pre conditions
+    assert(index != NULL);
+
+    if(index->slots != NULL) {
+        memset(index->slots, 0, index->capacity * sizeof(tHashSlot));
+    }
+    index->count = 0;
+}
+
+// Store an entry on the first free slot of its probe sequence. There must be at least one free slot.
+static void hashIndex_place(tHashSlot* slots, unsigned int capacity, unsigned int hash, unsigned int position) {
+    unsigned int i;
+
+    i = hash & (capacity - 1);
+    while(slots[i].position != 0) {
+        i = (i + 1) & (capacity - 1);
+    }
+    slots[i].hash = hash;
+    slots[i].position = position + 1;
+}
+
+// Make room for at least count entries without rehashing
+tError hashIndex_reserve(tHashIndex* index, unsigned int count) {
+    unsigned int capacity, i;
+    tHashSlot* slots;
+
+    // Verify pre conditions
+    assert(index != NULL);
+
+    // The load factor is kept under 1/2, so probe sequences stay short
+    capacity = (index->capacity == 0) ? HASH_INDEX_MIN_CAPACITY : index->capacity;
+    while(capacity / 2 < count) {
+        capacity = capacity * 2;
+    }
+
+    if(capacity == index->capacity) {
+        // There is already enough room
+        return OK;
+    }
+
+    // Allocate the new slots. calloc sets all of them to empty.
+    slots = (tHashSlot*) calloc(capacity, sizeof(tHashSlot));
+    if(slots == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    // Move the current entries to the new slots. The stored hash avoids recomputing it from the keys.
+    for(i=0; i<index->capacity; i++) {
+        if(index->slots[i].position != 0) {
+            hashIndex_place(slots, capacity, index->slots[i].hash, index->slots[i].position - 1);
+        }
+    }
+
+    if(index->slots != NULL) {
+        free(index->slots);
+    }
+    index->slots = slots;
+    index->capacity = capacity;
+
+    return OK;
+}
+
+// Add the position of an element with the given key hash
+tError hashIndex_insert(tHashIndex* index, unsigned int hash, unsigned int position) {
+    // Verify pre conditions
+    assert(index != NULL);
+
+    // Grow the slots if needed
+    if(hashIndex_reserve(index, index->count + 1) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    hashIndex_place(index->slots, index->capacity, hash, position);
+    index->count++;
+
+    return OK;
+}
+
+// Get the position of the element with the given key, or -1 if it is not indexed
+int hashIndex_find(tHashIndex* index, const char* key, unsigned int hash, tHashKeyFunction getKey, const void* table) {
+    unsigned int i;
+
+    // Verify pre conditions
+    assert(index != NULL);
+    assert(key != NULL);
+    assert(getKey != NULL);
+
+    if(index->count == 0) {
+        return -1;
+    }
+
+    // Follow the probe sequence until an empty slot. Keys are only compared when the hash matches.
+    i = hash & (index->capacity - 1);
+    while(index->slots[i].position != 0) {
+        if(index->slots[i].hash == hash && strcmp(getKey(table, index->slots[i].position - 1), key) == 0) {
+            return (int) (index->slots[i].position - 1);
+        }
+        i = (i + 1) & (index->capacity - 1);
+    }
+
+    return -1;
+}
+
+// Remove the entry of the element stored on a position
+bool hashIndex_remove(tHashIndex* index, unsigned int hash, unsigned int position) {
+    unsigned int i, j, home, mask;
+
+    // Verify pre conditions
+    assert(index != NULL);
+
+    if(index->count == 0) {
+        return false;
+    }
+    mask = index->capacity - 1;
+
+    // Search the slot of the element
+    i = hash & mask;
+    while(index->slots[i].position != position + 1) {
+        if(index->slots[i].position == 0) {
+            // Not indexed
+            return false;
+        }
+        i = (i + 1) & mask;
+    }
+
+    // Backward shift deletion: move back the next entries of the probe sequence that can be reached from the freed slot, so no tombstones are needed
+    j = i;
+    while(true) {
+        j = (j + 1) & mask;
+        if(index->slots[j].position == 0) {
+            break;
+        }
+        home = index->slots[j].hash & mask;
+        // Entries whose home slot is cyclically in (i, j] must stay where they are
+        if((i <= j) ? (i < home && home <= j) : (i < home || home <= j)) {
+            continue;
+        }
+        index->slots[i] = index->slots[j];
+        i = j;
+    }
+    index->slots[i].position = 0;
+    index->count--;
+
+    return true;
+}
+
+// Change the position stored for an element, after it is moved on the indexed table
+bool hashIndex_update(tHashIndex* index, unsigned int hash, unsigned int position, unsigned int newPosition) {
+    unsigned int i;
+
+    // Verify pre conditions
+    assert(index != NULL);
+
+    if(index->count == 0) {
+        return false;
+    }
+
+    // The entry is on the probe sequence of its hash. It keeps its slot, only the position changes.
+    i = hash & (index->capacity - 1);
+    while(index->slots[i].position != 0) {
+        if(index->slots[i].position == position + 1) {
+            index->slots[i].position = newPosition + 1;
+            return true;
+        }
+        i = (i + 1) & (index->capacity - 1);
+    }
+
+    return false;
+}
+
+// Decrease by one all the positions after the given one, after an element is removed and the next ones displaced
+void hashIndex_shift(tHashIndex* index, unsigned int position) {
+    unsigned int i;
+
+    // Verify pre conditions
+    assert(index != NULL);
+
+    // Stored positions are the element position plus 1
+    for(i=0; i<index->capacity; i++) {
+        if(index->slots[i].position > position + 1) {
+            index->slots[i].position--;
+        }
+    }
+}
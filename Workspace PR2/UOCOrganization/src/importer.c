@@ -0,0 +1,560 @@
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#include "importer.h"
+
+// Field of a row. The values are tokenized in place, on the read buffer.
+typedef struct {
+    // Name of the field on JSON rows, NULL on CSV rows
+    const char* key;
+    char* value;
+    // The value was a quoted string
+    bool quoted;
+} tImportField;
+
+// State of an import
+typedef struct {
+    tCongress* congress;
+    tGuestTable* guests;
+    tImportFormat format;
+    tImportStats* stats;
+    // Rows waiting to be added to the congress. Their fields point to the read buffer.
+    tGuest guestBatch[IMPORTER_BATCH_SIZE];
+    unsigned int guestCount;
+    tPresentationData presentationBatch[IMPORTER_BATCH_SIZE];
+    tError presentationErrors[IMPORTER_BATCH_SIZE];
+    unsigned int presentationCount;
+} tImporter;
+
+// Get the current time, in seconds
+static double importer_now(void) {
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+#endif
+}
+
+// Add the guests waiting on the batch
+static tError importer_flushGuests(tImporter* importer) {
+    tGuestTable* guests;
+    unsigned int size, capacity;
+
+    guests = importer->guests;
+    if(importer->guestCount == 0) {
+        return OK;
+    }
+
+    // guestTable_reserve allocates the exact capacity requested, so the table is grown geometrically here to add consecutive batches in linear time
+    size = guests->size;
+    if(size + importer->guestCount > guests->capacity) {
+        capacity = guests->capacity * 2;
+        if(capacity < size + importer->guestCount) {
+            capacity = size + importer->guestCount;
+        }
+        if(guestTable_reserve(guests, capacity) != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+    }
+    if(guestTable_addMany(guests, importer->guestBatch, importer->guestCount) == ERR_MEMORY_ERROR) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    // Repeated guests and guests with an invalid mail are skipped by the table
+    importer->stats->rows += guests->size - size;
+    importer->stats->rejected += importer->guestCount - (guests->size - size);
+    importer->guestCount = 0;
+
+    return OK;
+}
+
+// Add the presentations waiting on the batch
+static tError importer_flushPresentations(tImporter* importer) {
+    unsigned int i, added;
+
+    if(importer->presentationCount == 0) {
+        return OK;
+    }
+
+    added = congress_addPresentationsBatch(importer->congress, importer->presentationBatch, importer->presentationCount, importer->presentationErrors);
+    for(i=0; i<importer->presentationCount; i++) {
+        if(importer->presentationErrors[i] == ERR_MEMORY_ERROR) {
+            return ERR_MEMORY_ERROR;
+        }
+    }
+    importer->stats->rows += added;
+    importer->stats->rejected += importer->presentationCount - added;
+    importer->presentationCount = 0;
+
+    return OK;
+}
+
+// Add a guest row
+static tError importer_addGuest(tImporter* importer, char* username, char* name, char* mail) {
+    tGuest* guest;
+
+    guest = &(importer->guestBatch[importer->guestCount]);
+    guest->username = username;
+    guest->name = name;
+    guest->mail = mail;
+    importer->guestCount++;
+    if(importer->guestCount == IMPORTER_BATCH_SIZE) {
+        return importer_flushGuests(importer);
+    }
+
+    return OK;
+}
+
+// Add an organization row. Repeated organizations are found on the index of the congress.
+static tError importer_addOrganization(tImporter* importer, const char* name) {
+    tOrganization organization;
+    tError err;
+
+    // The congress copies the name, so the organization can point to the read buffer
+    organization.name = (char*) name;
+    organization.guests = importer->guests;
+    organization.id = 0;
+    organization.references = NULL;
+    err = congress_registerOrganization(importer->congress, &organization);
+    if(err == ERR_DUPLICATED) {
+        importer->stats->rejected++;
+        return OK;
+    }
+    if(err != OK) {
+        return err;
+    }
+
+    importer->stats->rows++;
+    return OK;
+}
+
+// Add a presentation row
+static tError importer_addPresentation(tImporter* importer, const char* organization, const char* score, const char* title, const char* topic) {
+    tPresentationData* presentation;
+    char* end;
+
+    presentation = &(importer->presentationBatch[importer->presentationCount]);
+    presentation->score = strtod(score, &end);
+    // The organization must be registered by a previous row. The presentations waiting on the batch are checked again when they are added.
+    if(end == score || *end != '\0' || congress_findOrganization(importer->congress, organization) == NULL) {
+        importer->stats->rejected++;
+        return OK;
+    }
+    presentation->organizationName = organization;
+    presentation->title = title;
+    presentation->topic = topic;
+    importer->presentationCount++;
+    if(importer->presentationCount == IMPORTER_BATCH_SIZE) {
+        return importer_flushPresentations(importer);
+    }
+
+    return OK;
+}
+
+// Split a CSV row on its fields. Returns the number of fields, or -1 if the row is not valid.
+static int importer_splitCsv(char* line, tImportField* fields) {
+    char* p;
+    char* dst;
+    char c;
+    int count;
+
+    p = line;
+    count = 0;
+    for(;;) {
+        if(count == IMPORTER_MAX_FIELDS) {
+            return -1;
+        }
+        fields[count].key = NULL;
+        fields[count].quoted = (*p == '"');
+        if(fields[count].quoted) {
+            // Quoted fields are unescaped in place, as their value is never longer than their text
+            p++;
+            dst = p;
+            fields[count].value = dst;
+            for(;;) {
+                if(*p == '\0') {
+                    return -1;
+                }
+                if(*p == '"') {
+                    if(p[1] != '"') {
+                        break;
+                    }
+                    p++;
+                }
+                *dst++ = *p++;
+            }
+            p++;
+            c = *p;
+            if(c != ',' && c != '\0') {
+                return -1;
+            }
+            *dst = '\0';
+        } else {
+            fields[count].value = p;
+            p += strcspn(p, ",");
+            c = *p;
+            *p = '\0';
+        }
+        count++;
+        if(c == '\0') {
+            return count;
+        }
+        p++;
+    }
+}
+
+// Skip the white spaces of a JSON row
+static char* importer_skipSpaces(char* p) {
+    while(*p == ' ' || *p == '\t') {
+        p++;
+    }
+    return p;
+}
+
+// Read 4 hexadecimal digits
+static bool importer_readHex(const char* p, unsigned long* code) {
+    int i;
+
+    *code = 0;
+    for(i=0; i<4; i++) {
+        if(!isxdigit((unsigned char) p[i])) {
+            return false;
+        }
+        *code = *code * 16 + (isdigit((unsigned char) p[i]) ? p[i] - '0' : tolower((unsigned char) p[i]) - 'a' + 10);
+    }
+    return true;
+}
+
+// Write a character as UTF-8. It never takes more bytes than its JSON escape sequence.
+static char* importer_writeUtf8(char* dst, unsigned long code) {
+    if(code < 0x80) {
+        *dst++ = (char) code;
+    } else if(code < 0x800) {
+        *dst++ = (char) (0xC0 | (code >> 6));
+        *dst++ = (char) (0x80 | (code & 0x3F));
+    } else if(code < 0x10000) {
+        *dst++ = (char) (0xE0 | (code >> 12));
+        *dst++ = (char) (0x80 | ((code >> 6) & 0x3F));
+        *dst++ = (char) (0x80 | (code & 0x3F));
+    } else {
+        *dst++ = (char) (0xF0 | (code >> 18));
+        *dst++ = (char) (0x80 | ((code >> 12) & 0x3F));
+        *dst++ = (char) (0x80 | ((code >> 6) & 0x3F));
+        *dst++ = (char) (0x80 | (code & 0x3F));
+    }
+    return dst;
+}
+
+// Unescape in place the JSON string starting at the cursor, moving it after the string. Returns NULL if the string is not valid.
+static char* importer_readString(char** cursor) {
+    char* src;
+    char* dst;
+    char* value;
+    unsigned long code, low;
+
+    src = *cursor + 1;
+    dst = src;
+    value = src;
+    while(*src != '"') {
+        // Control characters, including the end of the row, cannot be on a string
+        if((unsigned char) *src < 0x20) {
+            return NULL;
+        }
+        if(*src != '\\') {
+            *dst++ = *src++;
+            continue;
+        }
+        src++;
+        switch(*src) {
+            case '"':
+            case '\\':
+            case '/':
+                *dst++ = *src;
+                break;
+            case 'b':
+                *dst++ = '\b';
+                break;
+            case 'f':
+                *dst++ = '\f';
+                break;
+            case 'n':
+                *dst++ = '\n';
+                break;
+            case 'r':
+                *dst++ = '\r';
+                break;
+            case 't':
+                *dst++ = '\t';
+                break;
+            case 'u':
+                if(!importer_readHex(src + 1, &code)) {
+                    return NULL;
+                }
+                src += 4;
+                // Characters out of the basic plane are written as a pair of surrogates
+                if(code >= 0xD800 && code <= 0xDBFF && src[1] == '\\' && src[2] == 'u' && importer_readHex(src + 3, &low) && low >= 0xDC00 && low <= 0xDFFF) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    src += 6;
+                }
+                dst = importer_writeUtf8(dst, code);
+                break;
+            default:
+                return NULL;
+        }
+        src++;
+    }
+    *dst = '\0';
+    *cursor = src + 1;
+
+    return value;
+}
+
+// Split a JSON row on its fields. Only objects with string and number values are accepted. Returns the number of fields, or -1 if the row is not valid.
+static int importer_parseJson(char* line, tImportField* fields) {
+    char* p;
+    char c;
+    int count;
+
+    p = importer_skipSpaces(line);
+    if(*p != '{') {
+        return -1;
+    }
+    p = importer_skipSpaces(p + 1);
+    if(*p == '}') {
+        return *importer_skipSpaces(p + 1) == '\0' ? 0 : -1;
+    }
+
+    count = 0;
+    for(;;) {
+        if(count == IMPORTER_MAX_FIELDS || *p != '"') {
+            return -1;
+        }
+        fields[count].key = importer_readString(&p);
+        if(fields[count].key == NULL) {
+            return -1;
+        }
+        p = importer_skipSpaces(p);
+        if(*p != ':') {
+            return -1;
+        }
+        p = importer_skipSpaces(p + 1);
+
+        fields[count].quoted = (*p == '"');
+        if(fields[count].quoted) {
+            fields[count].value = importer_readString(&p);
+            if(fields[count].value == NULL) {
+                return -1;
+            }
+            p = importer_skipSpaces(p);
+            c = *p;
+        } else {
+            // Numbers are ended in place, keeping the character that follows them
+            fields[count].value = p;
+            p += strspn(p, "+-.eE0123456789");
+            if(p == fields[count].value) {
+                return -1;
+            }
+            c = *p;
+            *p = '\0';
+            if(c == ' ' || c == '\t') {
+                p = importer_skipSpaces(p + 1);
+                c = *p;
+            }
+        }
+        count++;
+
+        if(c == '}') {
+            return *importer_skipSpaces(p + 1) == '\0' ? count : -1;
+        } else if(c != ',') {
+            return -1;
+        }
+        p = importer_skipSpaces(p + 1);
+    }
+}
+
+// Get the value of a field of a JSON row, or NULL if it is not on the row or its type is not the expected one
+static char* importer_getField(tImportField* fields, int count, const char* key, bool quoted) {
+    int i;
+
+    for(i=0; i<count; i++) {
+        if(strcmp(fields[i].key, key) == 0) {
+            return fields[i].quoted == quoted ? fields[i].value : NULL;
+        }
+    }
+    return NULL;
+}
+
+// Import a row
+static tError importer_addRow(tImporter* importer, char* line) {
+    tImportField fields[IMPORTER_MAX_FIELDS];
+    char* values[4];
+    const char* type;
+    size_t length;
+    int count;
+
+    // Lines ending with "\r\n" are accepted, and empty lines and comments are skipped
+    length = strlen(line);
+    if(length > 0 && line[length - 1] == '\r') {
+        line[length - 1] = '\0';
+    }
+    if(line[0] == '\0' || line[0] == '#') {
+        return OK;
+    }
+
+    // The fields of both formats are taken in the same order
+    type = NULL;
+    memset(values, 0, sizeof(values));
+    if(importer->format == IMPORT_CSV) {
+        count = importer_splitCsv(line, fields);
+        if(count > 0) {
+            type = fields[0].value;
+            if((strcmp(type, "guest") == 0 && count == 4) || (strcmp(type, "organization") == 0 && count == 2) || (strcmp(type, "presentation") == 0 && count == 5)) {
+                for(count=count-1; count>0; count--) {
+                    values[count - 1] = fields[count].value;
+                }
+            } else {
+                type = NULL;
+            }
+        }
+    } else {
+        count = importer_parseJson(line, fields);
+        if(count > 0) {
+            type = importer_getField(fields, count, "type", true);
+        }
+        if(type != NULL && strcmp(type, "guest") == 0) {
+            values[0] = importer_getField(fields, count, "username", true);
+            values[1] = importer_getField(fields, count, "name", true);
+            values[2] = importer_getField(fields, count, "mail", true);
+        } else if(type != NULL && strcmp(type, "organization") == 0) {
+            values[0] = importer_getField(fields, count, "name", true);
+        } else if(type != NULL && strcmp(type, "presentation") == 0) {
+            values[0] = importer_getField(fields, count, "organization", true);
+            values[1] = importer_getField(fields, count, "score", false);
+            values[2] = importer_getField(fields, count, "title", true);
+            values[3] = importer_getField(fields, count, "topic", true);
+        }
+    }
+
+    if(type != NULL && strcmp(type, "guest") == 0 && values[0] != NULL && values[1] != NULL && values[2] != NULL) {
+        return importer_addGuest(importer, values[0], values[1], values[2]);
+    } else if(type != NULL && strcmp(type, "organization") == 0 && values[0] != NULL) {
+        return importer_addOrganization(importer, values[0]);
+    } else if(type != NULL && strcmp(type, "presentation") == 0 && values[0] != NULL && values[1] != NULL && values[2] != NULL && values[3] != NULL) {
+        return importer_addPresentation(importer, values[0], values[1], values[2], values[3]);
+    }
+
+    importer->stats->rejected++;
+    return OK;
+}
+
+// Import the rows of a stream into a congress. The organizations are registered with the given table of guests, where the guests are added.
+// Invalid rows are rejected and the import goes on. Returns ERR_CANNOT_READ if the stream cannot be read, or ERR_MEMORY_ERROR if there is no memory.
+tError congress_import(tCongress* object, tGuestTable* guests, FILE* input, tImportFormat format, tImportStats* stats) {
+    tImporter* importer;
+    char* buffer;
+    char* line;
+    char* end;
+    size_t pending, length;
+    bool skipping;
+    double start;
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(guests != NULL);
+    assert(input != NULL);
+    assert(stats != NULL);
+
+    memset(stats, 0, sizeof(tImportStats));
+    start = importer_now();
+
+    // The buffer has room for the end of the last line, if the input does not end with a new line
+    importer = (tImporter*) malloc(sizeof(tImporter));
+    buffer = (char*) malloc(IMPORTER_BUFFER_SIZE + 1);
+    if(importer == NULL || buffer == NULL) {
+        free(importer);
+        free(buffer);
+        return ERR_MEMORY_ERROR;
+    }
+    importer->congress = object;
+    importer->guests = guests;
+    importer->format = format;
+    importer->stats = stats;
+    importer->guestCount = 0;
+    importer->presentationCount = 0;
+
+    err = OK;
+    pending = 0;
+    skipping = false;
+    while(err == OK) {
+        length = fread(buffer + pending, 1, IMPORTER_BUFFER_SIZE - pending, input);
+        stats->bytes += length;
+        if(length == 0) {
+            if(ferror(input)) {
+                err = ERR_CANNOT_READ;
+            } else if(pending > 0 && !skipping) {
+                buffer[pending] = '\0';
+                err = importer_addRow(importer, buffer);
+            }
+            break;
+        }
+        pending += length;
+
+        // Import the complete lines of the buffer
+        line = buffer;
+        while(err == OK && (end = (char*) memchr(line, '\n', buffer + pending - line)) != NULL) {
+            *end = '\0';
+            if(!skipping) {
+                err = importer_addRow(importer, line);
+            }
+            skipping = false;
+            line = end + 1;
+        }
+
+        // The rows waiting on the batches point to the buffer, so they are added before reading over it
+        if(err == OK) {
+            err = importer_flushGuests(importer);
+        }
+        if(err == OK) {
+            err = importer_flushPresentations(importer);
+        }
+
+        // The incomplete line is moved to the start of the buffer. A line that does not fit on it is rejected, and the rest of it is skipped.
+        pending = buffer + pending - line;
+        memmove(buffer, line, pending);
+        if(pending == IMPORTER_BUFFER_SIZE) {
+            if(!skipping) {
+                stats->rejected++;
+            }
+            skipping = true;
+            pending = 0;
+        }
+    }
+    if(err == OK) {
+        err = importer_flushGuests(importer);
+    }
+    if(err == OK) {
+        err = importer_flushPresentations(importer);
+    }
+
+    stats->seconds = importer_now() - start;
+    stats->rowsPerSecond = (stats->seconds > 0) ? stats->rows / stats->seconds : 0;
+
+    free(importer);
+    free(buffer);
+
+    return err;
+}
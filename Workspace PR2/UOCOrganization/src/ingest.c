@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "ingest.h"
+
+// Initialize the queue
+void ingestQueue_init(tIngestQueue* queue) {
+    // Verify pre conditions
+    assert(queue != NULL);
+
+    // The empty queue has only the stub node
+    queue->stub.next = NULL;
+    queue->head = &(queue->stub);
+    queue->tail = &(queue->stub);
+    queue->added = 0;
+    queue->rejected = 0;
+}
+
+// Link a node at the head of the queue. The exchange orders the producers, and the release store publishes the node to the consumer.
+static void ingestQueue_link(tIngestQueue* queue, tIngestNode* node) {
+    tIngestNode* previous;
+
+    __atomic_store_n(&(node->next), NULL, __ATOMIC_RELAXED);
+    previous = __atomic_exchange_n(&(queue->head), node, __ATOMIC_ACQ_REL);
+    // Until this store, the consumer sees the queue cut after the previous node, and waits for it
+    __atomic_store_n(&(previous->next), node, __ATOMIC_RELEASE);
+}
+
+// Take the node at the tail of the queue, or NULL if there is none, or if the next one is still being linked
+static tIngestNode* ingestQueue_pop(tIngestQueue* queue) {
+    tIngestNode* tail;
+    tIngestNode* next;
+
+    tail = queue->tail;
+    next = __atomic_load_n(&(tail->next), __ATOMIC_ACQUIRE);
+
+    // The stub node is skipped
+    if(tail == &(queue->stub)) {
+        if(next == NULL) {
+            return NULL;
+        }
+        queue->tail = next;
+        tail = next;
+        next = __atomic_load_n(&(next->next), __ATOMIC_ACQUIRE);
+    }
+    if(next != NULL) {
+        queue->tail = next;
+        return tail;
+    }
+
+    // The tail is the last node. It can only be taken if no producer is linking a node after it, leaving the stub node after it.
+    if(tail != __atomic_load_n(&(queue->head), __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    ingestQueue_link(queue, &(queue->stub));
+    next = __atomic_load_n(&(tail->next), __ATOMIC_ACQUIRE);
+    if(next != NULL) {
+        queue->tail = next;
+        return tail;
+    }
+
+    return NULL;
+}
+
+// Remove the queue and the presentations still on it. No producer can use it.
+void ingestQueue_free(tIngestQueue* queue) {
+    tIngestNode* node;
+
+    // Verify pre conditions
+    assert(queue != NULL);
+
+    while((node = ingestQueue_pop(queue)) != NULL) {
+        free(node);
+    }
+    ingestQueue_init(queue);
+}
+
+// Submit a presentation. It can be called from any number of threads at the same time, without locks. The strings are copied.
+tError ingestQueue_push(tIngestQueue* queue, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic) {
+    tIngestNode* node;
+    size_t organizationLength, titleLength, topicLength;
+    char* strings;
+
+    // Verify pre conditions
+    assert(queue != NULL);
+    assert(organization_name != NULL);
+    assert(presentationTitle != NULL);
+    assert(presentationTopic != NULL);
+
+    // The node and its strings take a single allocation
+    organizationLength = strlen(organization_name) + 1;
+    titleLength = strlen(presentationTitle) + 1;
+    topicLength = strlen(presentationTopic) + 1;
+    node = (tIngestNode*) malloc(sizeof(tIngestNode) + organizationLength + titleLength + topicLength);
+    if(node == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    strings = (char*) (node + 1);
+    memcpy(strings, organization_name, organizationLength);
+    node->data.organizationName = strings;
+    strings += organizationLength;
+    memcpy(strings, presentationTitle, titleLength);
+    node->data.title = strings;
+    strings += titleLength;
+    memcpy(strings, presentationTopic, topicLength);
+    node->data.topic = strings;
+    node->data.score = score;
+
+    ingestQueue_link(queue, node);
+
+    return OK;
+}
+
+// Check if the consumer has no presentations to take. Presentations being pushed may not be seen yet.
+bool ingestQueue_empty(tIngestQueue* queue) {
+    // Verify pre conditions
+    assert(queue != NULL);
+
+    return queue->tail == &(queue->stub) && __atomic_load_n(&(queue->stub.next), __ATOMIC_ACQUIRE) == NULL;
+}
+
+// Take up to max presentations of the queue and add them to the congress, in batches. Only the consumer thread can call it. Returns the number of presentations taken.
+unsigned int congress_drainIngestQueue(tCongress* object, tIngestQueue* queue, unsigned int max) {
+    tIngestNode* nodes[INGEST_BATCH_SIZE];
+    tPresentationData rows[INGEST_BATCH_SIZE];
+    tIngestNode* node;
+    unsigned int i, count, taken, added;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(queue != NULL);
+
+    taken = 0;
+    do {
+        // The presentations are taken in the order of each producer, and the batch is added with the strings of the nodes
+        count = 0;
+        while(count < INGEST_BATCH_SIZE && taken + count < max && (node = ingestQueue_pop(queue)) != NULL) {
+            nodes[count] = node;
+            rows[count] = node->data;
+            count++;
+        }
+        if(count > 0) {
+            added = congress_addPresentationsBatch(object, rows, count, NULL);
+            queue->added += added;
+            queue->rejected += count - added;
+            for(i=0; i<count; i++) {
+                free(nodes[i]);
+            }
+        }
+        taken += count;
+    } while(count == INGEST_BATCH_SIZE && taken < max);
+
+    return taken;
+}
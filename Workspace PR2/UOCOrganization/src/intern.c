@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include "intern.h"
+
+// Initialize the intern table, storing the strings on the given arena
+void internTable_init(tInternTable* table, tArena* arena) {
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(arena != NULL);
+
+    table->size = 0;
+    table->capacity = 0;
+    table->strings = NULL;
+    hashIndex_init(&(table->index));
+    table->arena = arena;
+}
+
+// Remove the memory used by the intern table. The strings are released with the arena.
+void internTable_free(tInternTable* table) {
+    // Verify pre conditions
+    assert(table != NULL);
+
+    if(table->strings != NULL) {
+        free(table->strings);
+        table->strings = NULL;
+    }
+    table->size = 0;
+    table->capacity = 0;
+    hashIndex_free(&(table->index));
+}
+
+// Get the key used by the hash index for the string on a position of the table
+static const char* internTable_getKey(const void* table, unsigned int position) {
+    return ((const tInternTable*) table)->strings[position];
+}
+
+// Get the identifier of a string, adding it to the table if needed, copied to the arena or shared
+static unsigned int internTable_insert(tInternTable* table, const char* str, bool copy) {
+    const char** strings;
+    const char* canonical;
+    unsigned int hash, capacity;
+    int pos;
+
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(str != NULL);
+
+    // Strings already on the table keep their identifier
+    hash = hash_string(str);
+    pos = hashIndex_find(&(table->index), str, hash, internTable_getKey, table);
+    if(pos >= 0) {
+        return (unsigned int) pos + 1;
+    }
+
+    // The array of strings grows geometrically, as the tables of guests and organizations
+    if(table->size == table->capacity) {
+        capacity = (table->capacity == 0) ? HASH_INDEX_MIN_CAPACITY : table->capacity * 2;
+        strings = (const char**) realloc(table->strings, capacity * sizeof(const char*));
+        if(strings == NULL) {
+            return INTERN_NO_ID;
+        }
+        table->strings = strings;
+        table->capacity = capacity;
+    }
+
+    // Store the canonical copy of the string on the arena, unless the string is already there
+    canonical = copy ? arena_strdup(table->arena, str) : str;
+    if(canonical == NULL) {
+        return INTERN_NO_ID;
+    }
+    if(hashIndex_insert(&(table->index), hash, table->size) != OK) {
+        return INTERN_NO_ID;
+    }
+    table->strings[table->size] = canonical;
+    table->size = table->size + 1;
+
+    return table->size;
+}
+
+// Get the identifier of a string, adding it to the table if needed. Returns INTERN_NO_ID if there is no memory.
+unsigned int internTable_add(tInternTable* table, const char* str) {
+    return internTable_insert(table, str, true);
+}
+
+// Get the identifier of a string, adding it to the table without copying it if needed
+unsigned int internTable_addShared(tInternTable* table, const char* str) {
+    return internTable_insert(table, str, false);
+}
+
+// Get the identifier of a string, or INTERN_NO_ID if it is not on the table
+unsigned int internTable_find(tInternTable* table, const char* str) {
+    int pos;
+
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(str != NULL);
+
+    pos = hashIndex_find(&(table->index), str, hash_string(str), internTable_getKey, table);
+    if(pos < 0) {
+        return INTERN_NO_ID;
+    }
+
+    return (unsigned int) pos + 1;
+}
+
+// Get the canonical copy of the string with the given identifier
+const char* internTable_get(tInternTable* table, unsigned int id) {
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(id != INTERN_NO_ID && id <= table->size);
+
+    return table->strings[id - 1];
+}
@@ -3,6 +3,14 @@
 #include <string.h>
 #include "organization.h"
 
+// Last identifier given to an organization
+static unsigned int organization_lastId = 0;
+
+// Get a new identifier for an organization. Organizations are copied by the queries of a shared congress too, so the counter is increased atomically.
+static unsigned int organization_nextId(void) {
+    return __atomic_add_fetch(&organization_lastId, 1, __ATOMIC_RELAXED);
+}
+
 // Initialize the organization structure
 tError organization_init(tOrganization* object, const char* name, tGuestTable* guests) {
 
@@ -13,24 +21,51 @@ tError organization_init(tOrganization* object, const char* name, tGuestTable* g
     assert(name != NULL);
     assert(guests != NULL);
         
-    // Allocate the memory for organization name, using the length of the provided text plus 1 space for the "end of string" char '\0'. To allocate memory we use the malloc command.    
-    object->name = (char*) malloc((strlen(name) + 1) * sizeof(char));
+    // Allocate the memory for organization name, using the length of the provided text plus 1 space for the "end of string" char '\0'. The counter of references to the name is allocated on the same block, just before it.
+    object->references = (unsigned int*) malloc(sizeof(unsigned int) + (strlen(name) + 1) * sizeof(char));
         
     // Check that memory has been allocated. Pointer must be different from NULL.
-    if(object->name == NULL) {
+    if(object->references == NULL) {
         // The name field have a NULL value, what means that we found some problem allocating the memory
+        object->name = NULL;
         return ERR_MEMORY_ERROR;
     }
+    *(object->references) = 1;
+    object->name = (char*) (object->references + 1);
     
     // Once the memory is allocated, copy the data. As the name field is string, we need to use the string copy function strcpy.     
     strcpy(object->name, name);
         
     // Finally, we store the pointer to the guests. 
     object->guests = guests;
+    object->id = organization_nextId();
     
     return OK;     
 }
 
+// Initialize the organization structure, taking the memory of the name from an arena. The organization is released with the arena, not with organization_free.
+tError organization_initArena(tOrganization* object, tArena* arena, const char* name, tGuestTable* guests) {
+    
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(arena != NULL);
+    assert(name != NULL);
+    assert(guests != NULL);
+    
+    // The arena allocates and copies the name, which is not owned by the organization
+    object->references = NULL;
+    object->name = arena_strdup(arena, name);
+    if(object->name == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    // Finally, we store the pointer to the guests. 
+    object->guests = guests;
+    object->id = organization_nextId();
+    
+    return OK;
+}
+
 // Remove the memory used by organization structure
 void organization_free(tOrganization* object) {
     
@@ -39,14 +74,19 @@ void organization_free(tOrganization* object) {
     // Verify pre conditions
     assert(object != NULL);
     
-    // All memory allocated with malloc and realloc needs to be freed using the free command. In this case, as we use malloc to allocate the name field, we have to free it    
-    if(object->name != NULL) {
-        free(object->name);
-        object->name = NULL;
+    // All memory allocated with malloc and realloc needs to be freed using the free command. In this case, the name is shared by the copies of the organization, so it is only freed by the last one.
+    // The copies taken by the queries of a shared congress run at the same time, so the counter is changed atomically.
+    if(object->references != NULL) {
+        if(__atomic_sub_fetch(object->references, 1, __ATOMIC_ACQ_REL) == 0) {
+            free(object->references);
+        }
+        object->references = NULL;
     }
+    object->name = NULL;
     
     // We have not allocated memory for the guests, therefore we DO NOT free it. Just assign to NULL.    
     object->guests = NULL;  
+    object->id = 0;
 }
 
 // Compare two organizations
@@ -58,6 +98,11 @@ bool organization_equals(tOrganization* organization1, tOrganization* organizati
     assert(organization1 != NULL);
     assert(organization2 != NULL);
     
+    // Copies of the same organization sharing its guests are equal, without comparing their fields
+    if(organization1 == organization2 || (organization1->id != 0 && organization1->id == organization2->id && organization1->guests == organization2->guests)) {
+        return true;
+    }
+    
     // To see if two organizations are equals, we need to see ALL the values for their fields are equals.    
     // Strings are pointers to a table of chars, therefore, cannot be compared  as  " organization1->name == organization2->name ". 
     //We need to use a string comparison function        
@@ -87,14 +132,48 @@ tError organization_cpy(tOrganization* dst, tOrganization* src) {
     
     // Free the space used by destination object. An initialized object is assumed.
     dst->name = NULL;
+    dst->references = NULL;
     organization_free(dst);
     
-    // Initialize the element with the new data
-    organization_init(dst, src->name, src->guests);
+    // A name that is not owned by the source can be released before the copy, so it is copied. Otherwise the name is shared.
+    if(src->references == NULL) {
+        if(organization_init(dst, src->name, src->guests) != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+    } else {
+        dst->name = src->name;
+        dst->references = src->references;
+        __atomic_add_fetch(dst->references, 1, __ATOMIC_RELAXED);
+        dst->guests = src->guests;
+    }
+    // The copy keeps the identifier of the source. A source without identifier leaves the new one.
+    if(src->id != 0) {
+        dst->id = src->id;
+    }
     
     return OK;
 }
 
+// Move the data of a organization to another organization. The source organization gives the ownership of its name and is left empty.
+void organization_move(tOrganization* dst, tOrganization* src) {
+    
+    // Verify pre conditions
+    assert(dst != NULL);
+    assert(src != NULL);
+    
+    // Transfer the pointers instead of copying the name
+    dst->name = src->name;
+    dst->guests = src->guests;
+    dst->id = src->id;
+    dst->references = src->references;
+    
+    // The source do not own the name anymore
+    src->name = NULL;
+    src->guests = NULL;
+    src->id = 0;
+    src->references = NULL;
+}
+
 // Get the guestTable of a organization
 tGuestTable* organization_getGuests(tOrganization* organization) {
     // PR1 EX2
@@ -118,23 +197,83 @@ void organizationTable_init(tOrganizationTable* table) {
     // Using dynamic memory, the pointer to the elements must be set to NULL (no memory allocated). 
 	//This is the main difference with respect to the user of static memory, were data was allways initialized (tOrganization elements[MAX_ELEMENTS])
     table->elements = NULL;
+    table->capacity = 0;
+    // The names are allocated with malloc
+    table->arena = NULL;
+}
+
+// Initialize the Table of organizations, using an arena for the names of the elements
+void organizationTable_initArena(tOrganizationTable* table, tArena* arena) {
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(arena != NULL);
+    
+    organizationTable_init(table);
+    table->arena = arena;
+}
+
+// Modify the memory used by the table to store capacity elements
+static tError organizationTable_setCapacity(tOrganizationTable* table, unsigned int capacity) {
+    tOrganization* elements;
+    
+    assert(capacity >= table->size);
+    
+    // We cannot allocate zero bytes. An empty capacity releases the memory.
+    if(capacity == 0) {
+        if(table->elements != NULL) {
+            free(table->elements);
+            table->elements = NULL;
+        }
+        table->capacity = 0;
+        return OK;
+    }
+    
+    // realloc behaves as malloc when there is no previous memory block (NULL pointer). We keep the previous block if it fails.
+    elements = (tOrganization*) realloc(table->elements, capacity * sizeof(tOrganization));
+    if(elements == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    table->elements = elements;
+    table->capacity = capacity;
+    
+    return OK;
+}
+
+// Allocate memory for at least capacity elements
+tError organizationTable_reserve(tOrganizationTable* table, unsigned int capacity) {
+    // Verify pre conditions
+    assert(table != NULL);
+    
+    // The memory is never reduced by this method
+    if(capacity <= table->capacity) {
+        return OK;
+    }
+    
+    return organizationTable_setCapacity(table, capacity);
 }
 
 // Remove the memory used by organizationrTable structure
 void organizationTable_free(tOrganizationTable* object) {
         // PR1 EX3
+    unsigned int i;
     
     // Verify pre conditions
     assert(object != NULL);
     
     // All memory allocated with malloc and realloc needs to be freed using the free command. 
-    //In this case, as we use malloc/realloc to allocate the elements, and need to free them.
+    //In this case, as we use malloc/realloc to allocate the elements, and need to free them. The names are released too, unless they belong to the arena of the table.
+    if(object->arena == NULL) {
+        for(i=0; i<object->size; i++) {
+            organization_free(&(object->elements[i]));
+        }
+    }
     if(object->elements != NULL) {
         free(object->elements);
         object->elements = NULL;
     }
-    // As the table is now empty, assign the size to 0.
+    // As the table is now empty, assign the size and the capacity to 0.
     object->size = 0;
+    object->capacity = 0;
 }
 
 // Add a new organization to the table
@@ -147,34 +286,75 @@ tError organizationTable_add(tOrganizationTable* table, tOrganization* organizat
     
     if (organizationTable_find(table, organization->name))
         return ERR_DUPLICATED;     
+    
+    return organizationTable_append(table, organization);
+}
+
+// Add an organization that is known not to be on the table, without searching it
+tError organizationTable_append(tOrganizationTable* table, tOrganization* organization) {
+    
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(organization != NULL);
         
-    // The first step is to allocate the required space. There are two methods to manage the memory (malloc and realloc). Malloc allows to allocate a new memory block, while realloc allows to modify an existing memory block.    
-    if(table->size == 0) {
-        // Empty table
-        
-        // Increase the number of elements of the table
-        table->size = 1;
-        
-        // Since the table is empty, and we do not have any previous memory block, we have to use malloc. The amount of memory we need is the number of elements (will be 1) times the size of one element, which is computed by sizeof(type). In this case the type is tOrganization.
-        table->elements = (tOrganization*) malloc(table->size * sizeof(tOrganization));        
-    } else {
-        // Table with elements
-        
-        // Increase the number of elements of the table
-        table->size = table->size + 1 ;
-        
-        // Since the table is not empty, we already have a memory block. We need to modify the size of this block, using the realloc command. The amount of memory we need is the number of elements times the size of one element, which is computed by sizeof(type). In this case the type is tOrganization. We provide the previous block of memory.
-        table->elements = (tOrganization*) realloc(table->elements, table->size * sizeof(tOrganization));         
+    // The first step is to make sure there is space for a new element. When the allocated memory is full, its capacity is doubled, so the number of reallocations is logarithmic on the number of elements.
+    if(table->size == table->capacity) {
+        if(organizationTable_setCapacity(table, table->capacity == 0 ? ORGANIZATION_TABLE_MIN_CAPACITY : table->capacity * 2) != OK) {
+            // Error allocating or reallocating the memory
+            return ERR_MEMORY_ERROR;
+        }
     }
     
-    // Check that the memory has been allocated
-    if(table->elements == NULL) {
-        // Error allocating or reallocating the memory
+    // Increase the number of elements of the table
+    table->size = table->size + 1;
+    
+    // Once we have the block of memory, which is an array of tOrganization elements, we initialize the new element. If the table has an arena, the name is taken from it.
+    if(table->arena != NULL) {
+        if(organization_initArena(&(table->elements[table->size-1]), table->arena, organization->name, organization->guests) != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+    } else if(organization_cpy(&(table->elements[table->size-1]), organization) != OK) {
         return ERR_MEMORY_ERROR;
     }
+    // The element is a copy of the organization, so it keeps its identifier. An organization without identifier gets the new one.
+    if(organization->id != 0) {
+        table->elements[table->size-1].id = organization->id;
+    }
+    
+    return OK;
+}
+
+// Add an organization that is known not to be on the table, sharing its name instead of copying it
+tError organizationTable_appendShared(tOrganizationTable* table, tOrganization* organization) {
+    
+    // Verify pre conditions
+    assert(table != NULL);
+    assert(organization != NULL);
+    
+    if(table->size == table->capacity) {
+        if(organizationTable_setCapacity(table, table->capacity == 0 ? ORGANIZATION_TABLE_MIN_CAPACITY : table->capacity * 2) != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+    }
     
-    // Once we have the block of memory, which is an array of tOrganization elements, we initialize the new element
-    organization_init(&(table->elements[table->size-1]), organization->name, organization->guests);
+    // The element points to the same name, without taking a reference to it. An organization without identifier gets a new one.
+    table->elements[table->size].name = organization->name;
+    table->elements[table->size].guests = organization->guests;
+    table->elements[table->size].references = NULL;
+    table->elements[table->size].id = (organization->id != 0) ? organization->id : organization_nextId();
+    table->size = table->size + 1;
+    
+    return OK;
+}
+
+// Reduce the memory used by the table after an element is removed
+static tError organizationTable_shrink(tOrganizationTable* table) {
+    // If we removed the last element, we release the memory. Otherwise, the memory is halved when only a quarter of it is used.
+    if (table->size == 0) {
+        return organizationTable_setCapacity(table, 0);
+    } else if (table->size <= table->capacity / 4 && table->capacity > ORGANIZATION_TABLE_MIN_CAPACITY) {
+        return organizationTable_setCapacity(table, table->capacity / 2);
+    }
     
     return OK;
 }
@@ -183,53 +363,40 @@ tError organizationTable_add(tOrganizationTable* table, tOrganization* organizat
 tError organizationTable_remove(tOrganizationTable* table, tOrganization* organization) {
     // PR1 EX3
     
-    int i;
-    bool found;
+    int i, pos;
     
     // Verify pre conditions
     assert(table != NULL);
     assert(organization != NULL);
     
-    // To remove an element of a table, we will move all elements after this element one position, to fill the space of the removed element.
-    found = false;
-    for(i=0; i<table->size; i++) {
-        // If the element has been found. Displace this element to the previous element (will never happend for the first one). We use the ADDRESS of the previous element &(table->elements[i-1]) as destination, and ADDRESS of the current element &(table->elements[i]) as source.
-        if(found) {
-            // Check the return code to detect memory allocation errors
-            if(organization_cpy(&(table->elements[i-1]), &(table->elements[i])) == ERR_MEMORY_ERROR) {
-                // Error allocating memory. Just stop the process and return memory error.
-                return ERR_MEMORY_ERROR;
-            }
-        } else if(strcmp(table->elements[i].name, organization->name) == 0) {
-            // The current element is the element we want to remove. Set found flag to true to start element movement.
-            found = true;
+    // An element of the table is removed from its position. Otherwise, search the position of the element to remove.
+    pos = -1;
+    if(table->size > 0 && organization >= table->elements && organization < table->elements + table->size) {
+        pos = (int) (organization - table->elements);
+    }
+    for(i=0; i<table->size && pos < 0; i++) {
+        if(strcmp(table->elements[i].name, organization->name) == 0) {
+            pos = i;
         }
-    }    
+    }
     
-    // Once removed the element, we need to modify the memory used by the table.
-    if(found) {
-        // Modify the number of elements
-        table->size = table->size - 1;
-        
-        // If we are removing the last element, we will assign the pointer to NULL, since we cannot allocate zero bytes
-        if (table->size == 0) {
-            table->elements = NULL;
-        } else {                                    
-            // Modify the used memory. As we are modifying a previously allocated block, we need to use the realloc command.
-            table->elements = (tOrganization*) realloc(table->elements, table->size * sizeof(tOrganization));
-            
-            // Check that the memory has been allocated
-            if(table->elements == NULL) {
-                // Error allocating or reallocating the memory
-                return ERR_MEMORY_ERROR;
-            }
-        }
-    } else {
+    if(pos < 0) {
         // If the element was not in the table, return an error.
         return ERR_NOT_FOUND;
-    }         
+    }
     
-    return OK;
+    // Release the name of the removed element, unless it belongs to the arena of the table. The organization parameter can be this same element, so it is not used after this point.
+    if(table->arena == NULL) {
+        organization_free(&(table->elements[pos]));
+    }
+    
+    // To remove an element of a table, we move all elements after this element one position, to fill the space of the removed element. The names are owned by the table, so the structures are moved as a single block and nothing is allocated.
+    memmove(&(table->elements[pos]), &(table->elements[pos + 1]), (table->size - pos - 1) * sizeof(tOrganization));
+    
+    // Modify the number of elements and the used memory
+    table->size = table->size - 1;
+    
+    return organizationTable_shrink(table);
 }
 
 // Get organization by organization_name
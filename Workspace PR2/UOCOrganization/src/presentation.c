@@ -7,7 +7,8 @@
 // Make a copy of the queue
 void presentationQueue_duplicate(tPresentationQueue* dst, tPresentationQueue src) {
     
-    tPresentationQueueNode *pNode;
+    tPresentationQueueIterator it;
+    tPresentation *p;
     
     // Check preconditions
     assert(dst!=NULL);
@@ -15,52 +16,40 @@ void presentationQueue_duplicate(tPresentationQueue* dst, tPresentationQueue src
     // Initialize the new queue
     presentationQueue_createQueue(dst);
     
-    // Assign pointer to first element    
-    pNode = src.first;
-    while(pNode != NULL) {
-        // Enqueue the current element to the output queue
-        presentationQueue_enqueue(dst, pNode->e);
-        
-        // Move to next element
-        pNode = pNode->next;
-    }    
+    // Walk the source queue from its head, enqueuing each element to the output queue
+    for(presentationQueue_begin(&src, &it); (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        presentationQueue_enqueue(dst, *p);
+    }
 }
 
 
 // Implementation of compare method between two presentations queues using iterative algorithm
 bool presentationQueue_compareIterative(tPresentationQueue *q1, tPresentationQueue *q2) {
-    bool equals = true;
     tPresentation *p1, *p2;       
     
-    // While the queues have elements and all previous elements were equal, check for next elements    
-    while(equals && !presentationQueue_empty(*q1) && !presentationQueue_empty(*q2)) {
-        // Check if one of the queues is empty
-        if( (presentationQueue_empty(*q1) && !presentationQueue_empty(*q2)) || (!presentationQueue_empty(*q1) && presentationQueue_empty(*q2)) ) {
-            // Queues have different number of elements
-            equals = false;
-        } else {
-            // Both queues have elements. 
-            // Take head elements
-            p1 = presentationQueue_head(*q1);
-            p2 = presentationQueue_head(*q2);
-            
-            // Check that elements are not NULL
-            assert(p1 != NULL);
-            assert(p2 != NULL);
-            
-            // Compare the headers
-            if(!presentation_compare(*p1, *p2)) {                
-                // The elements are different.
-                equals = false;
-            }
-            
-            // Dequeue the head elements from queues
-            presentationQueue_dequeue(q1);
-            presentationQueue_dequeue(q2);
-        }        
+    // While both queues have elements, check the head elements. It leaves the queues as the recursive algorithm does.
+    while(!presentationQueue_empty(*q1) && !presentationQueue_empty(*q2)) {
+        // Take head elements
+        p1 = presentationQueue_head(*q1);
+        p2 = presentationQueue_head(*q2);
+        
+        // Check that elements are not NULL
+        assert(p1 != NULL);
+        assert(p2 != NULL);
+        
+        // Compare the headers
+        if(!presentation_compare(*p1, *p2)) {                
+            // The elements are different.
+            return false;
+        }
+        
+        // Dequeue the head elements from queues
+        presentationQueue_dequeue(q1);
+        presentationQueue_dequeue(q2);
     }
     
-    return equals;
+    // The queues are equal only if both have the same number of elements
+    return presentationQueue_empty(*q1) && presentationQueue_empty(*q2);
 }
 
 
@@ -103,22 +92,27 @@ bool presentationQueue_compareRecursive(tPresentationQueue *q1, tPresentationQue
 
 // Compare two presentation queues
 bool presentationQueue_compare(tPresentationQueue q1, tPresentationQueue q2) {
-    bool equals;
-    tPresentationQueue q1_dup, q2_dup;
-        
-    // Make a copy of the queues to avoid modifications
-    presentationQueue_duplicate(&q1_dup, q1);
-    presentationQueue_duplicate(&q2_dup, q2);
+    tPresentationQueueIterator it1, it2;
+    tPresentation *p1, *p2;
     
-    // Compare both queues
-    //equals = presentationQueue_compareIterative(&q1_dup, &q2_dup);
-    equals = presentationQueue_compareRecursive(&q1_dup, &q2_dup);
-
-    // Remove the remaining elements
-    presentationQueue_free(&q1_dup);
-    presentationQueue_free(&q2_dup);
+    // Walk both queues at the same time, without modifying them
+    presentationQueue_begin(&q1, &it1);
+    presentationQueue_begin(&q2, &it2);
+    p1 = presentationQueue_get(&it1);
+    p2 = presentationQueue_get(&it2);
+    while(p1 != NULL && p2 != NULL) {
+        if(!presentation_compare(*p1, *p2)) {
+            // The elements are different.
+            return false;
+        }
+        presentationQueue_next(&it1);
+        presentationQueue_next(&it2);
+        p1 = presentationQueue_get(&it1);
+        p2 = presentationQueue_get(&it2);
+    }
     
-    return equals;
+    // The queues are equal if both have been completely walked
+    return p1 == NULL && p2 == NULL;
 }
 
 
@@ -158,6 +152,39 @@ void presentation_init(tPresentation *object, tOrganization *organization, doubl
     strcpy(object->presentationTopic, presentationTopic);
    
     organization_cpy(&object->organization, organization);
+    
+    // The strings are not interned
+    object->topicId = INTERN_NO_ID;
+    object->organizationId = INTERN_NO_ID;
+}
+
+
+// Initialize a presentation structure, taking the memory of the strings from an arena
+tError presentation_initArena(tPresentation *object, tArena* arena, tOrganization *organization, double score, const char* presentationTitle, const char* presentationTopic) {
+    // Check preconditions
+    assert(object != NULL);
+    assert(arena != NULL);
+    assert(organization != NULL);
+    assert(presentationTitle != NULL);
+    assert(presentationTopic != NULL);
+    
+    object->score = score;
+    // The arena allocates and copies the strings, including the name of the organization
+    object->presentationTitle = arena_strdup(arena, presentationTitle);
+    object->presentationTopic = arena_strdup(arena, presentationTopic);
+    if(object->presentationTitle == NULL || object->presentationTopic == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    // The strings are not interned
+    object->topicId = INTERN_NO_ID;
+    object->organizationId = INTERN_NO_ID;
+    
+    if(organization_initArena(&object->organization, arena, organization->name, organization->guests) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+    object->organization.id = organization->id;
+    return OK;
 }
 
 
@@ -178,10 +205,56 @@ void presentation_duplicate(tPresentation* dst, tPresentation src) {
     dst->score = src.score ;
     organization_cpy(&dst->organization, &src.organization);
 
+    // The copy has its own strings, which do not belong to any intern table
+    dst->topicId = INTERN_NO_ID;
+    dst->organizationId = INTERN_NO_ID;
+
     //organizationScore_duplicate(&(dst->score), src.score);
 }
 
 
+// Duplicate a presentation, taking the memory of the strings from an arena. Interned strings are shared instead of copied.
+tError presentation_duplicateArena(tPresentation* dst, tArena* arena, tPresentation src) {
+    
+    // Check preconditions
+    assert(dst!=NULL);
+    assert(arena!=NULL);
+    
+    dst->score = src.score;
+    dst->presentationTitle = arena_strdup(arena, src.presentationTitle);
+    if(dst->presentationTitle == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    
+    // The interned strings are kept on the arena of the congress that owns the intern table, so the canonical copy is shared. Other strings are copied.
+    dst->topicId = src.topicId;
+    if(src.topicId != INTERN_NO_ID) {
+        dst->presentationTopic = src.presentationTopic;
+    } else {
+        dst->presentationTopic = arena_strdup(arena, src.presentationTopic);
+        if(dst->presentationTopic == NULL) {
+            return ERR_MEMORY_ERROR;
+        }
+    }
+    
+    // A name with references is shared. An interned name without references belongs to the arena of the congress, so the pointer is shared.
+    dst->organizationId = src.organizationId;
+    if(src.organization.references != NULL) {
+        return organization_cpy(&dst->organization, &src.organization);
+    }
+    if(src.organizationId != INTERN_NO_ID) {
+        dst->organization = src.organization;
+        return OK;
+    }
+    
+    if(organization_initArena(&dst->organization, arena, src.organization.name, src.organization.guests) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+    dst->organization.id = src.organization.id;
+    return OK;
+}
+
+
 // Compare two presentations
 bool presentation_compare(tPresentation p1, tPresentation p2) {    
     // Compare the values of both structures
@@ -195,29 +268,164 @@ bool presentation_compare(tPresentation p1, tPresentation p2) {
 /*********	Create the presentation queue	***********/
 void presentationQueue_createQueue(tPresentationQueue* queue) {
     // PR2 EX1
+	//The queue is a linked list and the strings of the presentations are allocated with malloc
+	presentationQueue_createQueueType(queue, PRESENTATION_QUEUE_LIST, NULL);
+}
+
+
+/*********	Create the presentation queue using an arena for the strings	***********/
+void presentationQueue_createQueueArena(tPresentationQueue* queue, tArena* arena) {
+	//Check preconditions
+	assert(arena != NULL);
+	
+	presentationQueue_createQueueType(queue, PRESENTATION_QUEUE_LIST, arena);
+}
+
+
+/*********	Create the presentation queue with the given storage	***********/
+void presentationQueue_createQueueType(tPresentationQueue* queue, tPresentationQueueType type, tArena* arena) {
 	//Check preconditions
 	assert(queue != NULL);
 	
 	//The two pointers are pointed to NULL. That's means the queue is empty.
 	queue->first = NULL;
 	queue->last = NULL;
+	queue->arena = arena;
+	//The nodes are allocated with malloc
+	queue->pool = NULL;
+	queue->type = type;
+	//The array of a ring queue is allocated with the first presentation
+	queue->elements = NULL;
+	queue->capacity = 0;
+	queue->head = 0;
+	queue->count = 0;
 }
 
 
-/*********	Enqueue a new presentation to the presentation queue	***********/
-tError presentationQueue_enqueue(tPresentationQueue* queue, tPresentation presentation) {
-    // PR2 EX1
-    //return ERR_NOT_IMPLEMENTED;
-	tPresentationQueueNode *tmp;
+/*********	Use a pool for the nodes of an empty queue	***********/
+void presentationQueue_setPool(tPresentationQueue* queue, tPresentationNodePool* pool) {
+	//Check preconditions
+	assert(queue != NULL);
+	assert(presentationQueue_empty(*queue));
+	
+	queue->pool = pool;
+}
+
+
+/*********	Move the presentations of a ring queue to an array with the given capacity	***********/
+static tError presentationQueue_setRingCapacity(tPresentationQueue* queue, unsigned int capacity) {
+	tPresentation *elements;
+	unsigned int i;
+	
+	elements = (tPresentation*) malloc(capacity * sizeof(tPresentation));
+	if(elements == NULL){
+		return ERR_MEMORY_ERROR;
+	}
+	
+	//The presentations are moved to the start of the new array, in order
+	for(i=0; i<queue->count; i++){
+		elements[i] = queue->elements[(queue->head + i) & (queue->capacity - 1)];
+	}
+	if(queue->elements != NULL){
+		free(queue->elements);
+	}
+	queue->elements = elements;
+	queue->capacity = capacity;
+	queue->head = 0;
+	
+	return OK;
+}
+
+
+/*********	Make room for one more presentation on a ring queue	***********/
+static tError presentationQueue_growRing(tPresentationQueue* queue) {
+	if(queue->count < queue->capacity){
+		return OK;
+	}
+	
+	//The capacity is doubled, so the number of reallocations is logarithmic on the number of presentations
+	return presentationQueue_setRingCapacity(queue, (queue->capacity == 0) ? PRESENTATION_QUEUE_MIN_CAPACITY : queue->capacity * 2);
+}
+
+
+/*********	Make room for count more presentations	***********/
+tError presentationQueue_reserve(tPresentationQueue* queue, unsigned int count) {
+	unsigned int capacity;
 	//Check preconditions
 	assert(queue != NULL);
-	// Allocate the memory for a presentationQueueNode
-	tmp = (tPresentationQueueNode*) malloc(sizeof(tPresentationQueueNode));
+	
+	//the nodes of a list queue are taken from its pool, which allocates them in slabs. Without a pool, they are allocated one by one.
+	if(queue->type != PRESENTATION_QUEUE_RING){
+		return (queue->pool != NULL) ? presentationNodePool_reserve(queue->pool, count) : OK;
+	}
+	if(queue->count + count <= queue->capacity){
+		return OK;
+	}
+	
+	capacity = (queue->capacity == 0) ? PRESENTATION_QUEUE_MIN_CAPACITY : queue->capacity;
+	while(capacity < queue->count + count){
+		capacity = capacity * 2;
+	}
+	return presentationQueue_setRingCapacity(queue, capacity);
+}
+
+
+/*********	Copy a presentation to its position on the queue, or share its strings	***********/
+static tError presentationQueue_store(tPresentationQueue* queue, tPresentation* dst, tPresentation presentation, bool copy) {
+	if(!copy){
+		//The strings are already on the arena of the queue. Only a reference to the name of the organization is taken.
+		*dst = presentation;
+		if(presentation.organization.references != NULL){
+			return organization_cpy(&dst->organization, &presentation.organization);
+		}
+		return OK;
+	}
+	if(queue->arena != NULL){
+		//Duplicate the presentation using the arena of the queue
+		return presentation_duplicateArena(dst, queue->arena, presentation);
+	}
+	presentation_duplicate(dst, presentation);
+	return OK;
+}
+
+
+/*********	Enqueue a new presentation, copying its strings or sharing them	***********/
+static tError presentationQueue_insert(tPresentationQueue* queue, tPresentation presentation, bool copy) {
+	tPresentationQueueNode *tmp;
+	tPresentation *e;
+	
+	if(queue->type == PRESENTATION_QUEUE_RING){
+		//The presentation is stored on the next free position of the array, after the last one
+		if(presentationQueue_growRing(queue) != OK){
+			return ERR_MEMORY_ERROR;
+		}
+		e = &(queue->elements[(queue->head + queue->count) & (queue->capacity - 1)]);
+		if(presentationQueue_store(queue, e, presentation, copy) != OK){
+			return ERR_MEMORY_ERROR;
+		}
+		queue->count = queue->count + 1;
+		return OK;
+	}
+	
+	// Allocate the memory for a presentationQueueNode, from the pool of the queue if it has one
+	if(queue->pool != NULL){
+		tmp = presentationNodePool_alloc(queue->pool);
+	} else {
+		tmp = (tPresentationQueueNode*) malloc(sizeof(tPresentationQueueNode));
+	}
 	//Check the allocated memory
 	if(tmp == NULL){
 		return ERR_MEMORY_ERROR;
 	} else {
-		presentation_duplicate(&(tmp->e), presentation); //Duplicate the presentation in the variable e of the node
+		//Duplicate the presentation in the variable e of the node
+		if(presentationQueue_store(queue, &(tmp->e), presentation, copy) != OK){
+			if(queue->pool != NULL){
+				presentationNodePool_release(queue->pool, tmp);
+			} else {
+				free(tmp);
+			}
+			return ERR_MEMORY_ERROR;
+		}
 		tmp->next = NULL; //The pointer of node point to NULL,
 		if(queue->first == NULL){
 			//if the queue is empty, the pointer first of the queue points to the new node
@@ -232,10 +440,81 @@ tError presentationQueue_enqueue(tPresentationQueue* queue, tPresentation presen
 }
 
 
+/*********	Enqueue a new presentation to the presentation queue	***********/
+tError presentationQueue_enqueue(tPresentationQueue* queue, tPresentation presentation) {
+    // PR2 EX1
+    //return ERR_NOT_IMPLEMENTED;
+	//Check preconditions
+	assert(queue != NULL);
+	
+	return presentationQueue_insert(queue, presentation, true);
+}
+
+
+/*********	Enqueue a new presentation whose strings are already on the arena of the queue	***********/
+tError presentationQueue_enqueueShared(tPresentationQueue* queue, tPresentation presentation) {
+	//Check preconditions
+	assert(queue != NULL);
+	assert(queue->arena != NULL);
+	
+	return presentationQueue_insert(queue, presentation, false);
+}
+
+
+/**********	Place a cursor on the head of the queue	**************/
+void presentationQueue_begin(tPresentationQueue* queue, tPresentationQueueIterator* it) {
+	//Check preconditions
+	assert(queue != NULL);
+	assert(it != NULL);
+	
+	it->queue = queue;
+	it->node = queue->first;
+	it->position = 0;
+}
+
+
+/**********	Move a cursor to the next presentation	**************/
+void presentationQueue_next(tPresentationQueueIterator* it) {
+	//Check preconditions
+	assert(it != NULL);
+	
+	if(it->queue->type == PRESENTATION_QUEUE_RING){
+		if(it->position < it->queue->count){
+			it->position = it->position + 1;
+		}
+	} else if(it->node != NULL){
+		it->node = it->node->next;
+	}
+}
+
+
+/**********	Get the presentation of a cursor	**************/
+tPresentation* presentationQueue_get(tPresentationQueueIterator* it) {
+	//Check preconditions
+	assert(it != NULL);
+	
+	//the presentations of a ring queue are consecutive on its array, starting at its head
+	if(it->queue->type == PRESENTATION_QUEUE_RING){
+		if(it->position >= it->queue->count){
+			return NULL;
+		}
+		return &(it->queue->elements[(it->queue->head + it->position) & (it->queue->capacity - 1)]);
+	}
+	if(it->node == NULL){
+		return NULL;
+	}
+	return &(it->node->e);
+}
+
+
 /**********	Check if the queue is empty	**************/
 bool presentationQueue_empty(tPresentationQueue queue) {
     // PR2 EX1
 	//return false;
+	//a ring queue is empty when it has no elements on the array
+	if(queue.type == PRESENTATION_QUEUE_RING){
+		return queue.count == 0;
+	}
 	//if the pointer first of the queue points to NULL, the queue is empty
 	return queue.first == NULL;
 }
@@ -245,11 +524,41 @@ bool presentationQueue_empty(tPresentationQueue queue) {
 tPresentation* presentationQueue_head(tPresentationQueue queue) {
     // PR2 EX2
     //return NULL;
-	//this function return a pointer to the element on the head of the queue.
+	//this function return a pointer to the element on the head of the queue, or NULL if it is empty.
+	if(presentationQueue_empty(queue)){
+		return NULL;
+	}
+	if(queue.type == PRESENTATION_QUEUE_RING){
+		return &(queue.elements[queue.head]);
+	}
 	return &(queue.first->e);
 }
 
 
+/**************	Return the last element from the queue	****************/
+tPresentation* presentationQueue_last(tPresentationQueue queue) {
+	//a pointer to the element on the tail of the queue, or NULL if it is empty.
+	if(presentationQueue_empty(queue)){
+		return NULL;
+	}
+	if(queue.type == PRESENTATION_QUEUE_RING){
+		return &(queue.elements[(queue.head + queue.count - 1) & (queue.capacity - 1)]);
+	}
+	return &(queue.last->e);
+}
+
+
+/*************	Release the data of a presentation stored on a queue	******************/
+static void presentationQueue_release(tPresentationQueue* queue, tPresentation* presentation) {
+	//the reference to the name of the organization is released. Without an arena, the strings were allocated by presentation_duplicate.
+	organization_free(&(presentation->organization));
+	if(queue->arena == NULL){
+		free(presentation->presentationTitle);
+		free(presentation->presentationTopic);
+	}
+}
+
+
 /*************	Dequeue a presentation from the presentation queue	******************/
 void presentationQueue_dequeue(tPresentationQueue* queue) {
     // PR2 EX2
@@ -257,14 +566,29 @@ void presentationQueue_dequeue(tPresentationQueue* queue) {
 	//Check preconditions
 	assert(queue != NULL);
 	
+	if(queue->type == PRESENTATION_QUEUE_RING){
+		//the head moves to the next position of the array, which is kept allocated for new presentations
+		if(queue->count > 0){
+			presentationQueue_release(queue, &(queue->elements[queue->head]));
+			queue->head = (queue->head + 1) & (queue->capacity - 1);
+			queue->count = queue->count - 1;
+		}
+		return;
+	}
+	
 	if(!presentationQueue_empty(*queue)){	//if the queue isn't empty
 		tmp = queue->first;					//the pointer tmp points to the first element of the queue
+		presentationQueue_release(queue, &(tmp->e));
 		queue->first = tmp->next;			//and the pointer first of the queue points to the next element
 		if(presentationQueue_empty(*queue)){//if the que is empty
 			queue->last = NULL;				//the pointer last points to NULL
 		}
-		//finally deallocates the memory of the tmp previously allocated by a call to malloc.
-		free(tmp);
+		//finally gives back the node to the pool, or deallocates the memory of the tmp previously allocated by a call to malloc.
+		if(queue->pool != NULL){
+			presentationNodePool_release(queue->pool, tmp);
+		} else {
+			free(tmp);
+		}
 	}
 }
 
@@ -274,6 +598,19 @@ void presentationQueue_free(tPresentationQueue* queue) {
     // PR2 EX2
 	//Check preconditions
 	assert(queue != NULL);
+	//a ring queue releases its array at once, after the data of its presentations
+	if(queue->type == PRESENTATION_QUEUE_RING){
+		while(queue->count > 0){
+			presentationQueue_dequeue(queue);
+		}
+		if(queue->elements != NULL){
+			free(queue->elements);
+			queue->elements = NULL;
+		}
+		queue->capacity = 0;
+		queue->head = 0;
+		queue->count = 0;
+	}
 	//iterate the queue and dequeue all the nodes of the queue until it's empty
 	while(!presentationQueue_empty(*queue)){
 		presentationQueue_dequeue(queue);
@@ -284,43 +621,79 @@ void presentationQueue_free(tPresentationQueue* queue) {
 }
 
 
+/*****************	Sum the scores of an organization, from a cursor to the end of the queue	*********************/
+static double presentationQueue_getOrganizationScoreFrom(tPresentationQueueIterator it, tOrganization *organization) {
+	tPresentation *p;
+	double scoreAux;
+	
+	p = presentationQueue_get(&it);
+	//The base case: the cursor is after the last presentation
+	if(p == NULL){
+		return 0;
+	}
+	
+	//the score is only added if the presentation is from the organization
+	scoreAux = organization_equals(&(p->organization), organization) ? p->score : 0;
+	// The recursive case, with the cursor moved to the next presentation
+	presentationQueue_next(&it);
+	return scoreAux + presentationQueue_getOrganizationScoreFrom(it, organization);
+}
+
+
 /*****************	Get the average score for an organization	*********************/
 double presentationQueue_getOrganizationScoreRecursive(tPresentationQueue *queue, tOrganization *organization) {    
     // PR2 EX3
     //return ERR_NOT_IMPLEMENTED;
+	tPresentationQueueIterator it;
 	//Check preconditions
 	assert(queue != NULL);
 	assert(organization != NULL);
 	
-	tPresentationQueueNode *first;
-	//first saves the pointer first of the queue
-	first = queue->first;
+	//the queue is walked with a cursor, so it is not modified
+	presentationQueue_begin(queue, &it);
+	return presentationQueue_getOrganizationScoreFrom(it, organization);
+}
+
+
+/*****************	Get the average score for an organization, without recursion	*********************/
+double presentationQueue_getOrganizationScoreIterative(tPresentationQueue *queue, tOrganization *organization) {
+	tPresentationQueueIterator it;
+	tPresentation *p;
+	double score = 0;
+	//Check preconditions
+	assert(queue != NULL);
+	assert(organization != NULL);
 	
-	double result, scoreAux;
-	//The base case
-	if(queue->first == queue->last){ //if the queue have only a node
-		if(organization_equals(&(queue->first->e.organization), organization)){	//if the organization found
-			result = queue->first->e.score; //the variable result saves the score of this organization in the last node.
-		} else {
-			//if the last node don't contain the organization, result saves 0
-			result = 0;
+	//the scores are added in the same order as the recursive function, so the result is exactly the same
+	for(presentationQueue_begin(queue, &it); (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)){
+		if(organization_equals(&(p->organization), organization)){
+			score += p->score;
 		}
-	} else {
-	// The recursive case
-		if(organization_equals(&(queue->first->e.organization), organization)){ //if the organization found
-			scoreAux = queue->first->e.score;			//the value of score is saved in the variable scoreAux
-			queue->first = queue->first->next;			//the pointer first of the queue points to the next node
-			//result saves the sum of the scoreAux and the result of the recursive case with first pointed to the next node
-			result = scoreAux + presentationQueue_getOrganizationScoreRecursive(queue, organization);
-		} else {
-			//if the organization isn't found
-			queue->first = queue->first->next;	//the pointer first of the queue points to the next node
-			//result saves the result of the recursive case with first pointed to the next node
-			result = presentationQueue_getOrganizationScoreRecursive(queue, organization);
+	}
+	return score;
+}
+
+
+/*****************	Enqueue the presentations of an organization, from a cursor to the end of the queue	*********************/
+static tError presentationQueue_getOrganizationPresentationsFrom(tPresentationQueueIterator it, tOrganization *organization, tPresentationQueue* presentations) {
+	tPresentation *p;
+	tError err;
+	
+	p = presentationQueue_get(&it);
+	//The base case: the cursor is after the last presentation
+	if(p == NULL){
+		return OK;
+	}
+	//the presentation is only enqueued if it is from the organization
+	if(organization_equals(&(p->organization), organization)){
+		err = presentationQueue_enqueue(presentations, *p);
+		if(err != OK){
+			return err;
 		}
 	}
-	queue->first = first; //the queue recovers the initial direction of the pointer first.
-	return result;
+	//The recursive case, with the cursor moved to the next presentation. It is a tail call.
+	presentationQueue_next(&it);
+	return presentationQueue_getOrganizationPresentationsFrom(it, organization, presentations);
 }
 
 
@@ -328,26 +701,168 @@ double presentationQueue_getOrganizationScoreRecursive(tPresentationQueue *queue
 tError presentationQueue_getOrganizationPresentationsRecursive(tPresentationQueue *queue, tOrganization *organization, tPresentationQueue* presentations) {
     // PR2 EX3
      //return ERR_NOT_IMPLEMENTED;
+	tPresentationQueueIterator it;
 	 //Check preconditions
 	 assert(queue != NULL);
 	 assert(organization != NULL);
 	 assert(presentations != NULL);
-	 
-	tPresentationQueueNode *first;
-	//first saves the pointer first of the queue
-	first = queue->first;
-	//The base case
-	if(queue->first == queue->last){	//if the queue have only a node
-		if(organization_equals(&(queue->first->e.organization), organization)){	//if the organization found
-			//return the function enqueue with the last element of the queue
-			return presentationQueue_enqueue(presentations, queue->first->e);
-		} 
-	} else {
-		queue->first = queue->first->next;
-		//if the organization isn't found, then is called again the recursive function with the pointer first pointed to the next node
-		presentationQueue_getOrganizationPresentationsRecursive(queue, organization, presentations);
+	
+	//the queue is walked with a cursor, so it is not modified
+	presentationQueue_begin(queue, &it);
+	return presentationQueue_getOrganizationPresentationsFrom(it, organization, presentations);
+}
+
+
+/*****************	Get a queue with all the presentations for an organization, without recursion	*********************/
+tError presentationQueue_getOrganizationPresentationsIterative(tPresentationQueue *queue, tOrganization *organization, tPresentationQueue* presentations) {
+	tPresentationQueueIterator it;
+	tPresentation *p;
+	tError err;
+	//Check preconditions
+	assert(queue != NULL);
+	assert(organization != NULL);
+	assert(presentations != NULL);
+	
+	for(presentationQueue_begin(queue, &it); (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)){
+		if(organization_equals(&(p->organization), organization)){
+			err = presentationQueue_enqueue(presentations, *p);
+			if(err != OK){
+				return err;
+			}
+		}
+	}
+	return OK;
+}
+
+
+/*********	Initialize a pool of queue nodes	***********/
+void presentationNodePool_init(tPresentationNodePool* pool) {
+	//Check preconditions
+	assert(pool != NULL);
+	
+	//The slabs are allocated with the first request
+	pool->slabs = NULL;
+	pool->spare = NULL;
+	pool->freeList = NULL;
+	pool->fresh = 0;
+	memset(&(pool->stats), 0, sizeof(tPresentationNodePoolStats));
+}
+
+
+/*********	Remove the memory used by a pool of queue nodes	***********/
+void presentationNodePool_free(tPresentationNodePool* pool) {
+	tPresentationNodeSlab *slab;
+	//Check preconditions
+	assert(pool != NULL);
+	
+	//All the nodes are released with their slabs
+	while(pool->slabs != NULL){
+		slab = pool->slabs;
+		pool->slabs = slab->next;
+		free(slab);
+	}
+	while(pool->spare != NULL){
+		slab = pool->spare;
+		pool->spare = slab->next;
+		free(slab);
+	}
+	presentationNodePool_init(pool);
+}
+
+
+/*********	Allocate a new slab of nodes	***********/
+static tPresentationNodeSlab* presentationNodePool_allocSlab(tPresentationNodePool* pool) {
+	tPresentationNodeSlab *slab;
+	
+	slab = (tPresentationNodeSlab*) malloc(sizeof(tPresentationNodeSlab));
+	if(slab != NULL){
+		pool->stats.slabs++;
+		pool->stats.nodes += PRESENTATION_NODE_POOL_SLAB_SIZE;
+	}
+	return slab;
+}
+
+
+/*********	Make room for count more nodes	***********/
+tError presentationNodePool_reserve(tPresentationNodePool* pool, unsigned int count) {
+	tPresentationNodeSlab *slab;
+	//Check preconditions
+	assert(pool != NULL);
+	
+	//the nodes that are not used are on the free list, on the first slab or on the reserved slabs. The missing ones are allocated on reserved slabs.
+	while(pool->stats.nodes - pool->stats.used < count){
+		slab = presentationNodePool_allocSlab(pool);
+		if(slab == NULL){
+			return ERR_MEMORY_ERROR;
+		}
+		slab->next = pool->spare;
+		pool->spare = slab;
 	}
-	queue->first = first; //the queue recovers the initial direction of the pointer first.
 	return OK;
 }
 
+
+/*********	Get a node from the pool	***********/
+tPresentationQueueNode* presentationNodePool_alloc(tPresentationNodePool* pool) {
+	tPresentationQueueNode *node;
+	tPresentationNodeSlab *slab;
+	//Check preconditions
+	assert(pool != NULL);
+	
+	pool->stats.requests++;
+	
+	if(pool->freeList != NULL){
+		//a released node is used again
+		node = pool->freeList;
+		pool->freeList = node->next;
+		pool->stats.reuses++;
+	} else {
+		//otherwise, the next unused node of the first slab is taken. When all of them are used, a reserved slab is taken, or a new one is allocated.
+		if(pool->fresh == 0){
+			if(pool->spare != NULL){
+				slab = pool->spare;
+				pool->spare = slab->next;
+			} else {
+				slab = presentationNodePool_allocSlab(pool);
+			}
+			if(slab == NULL){
+				pool->stats.requests--;
+				return NULL;
+			}
+			slab->next = pool->slabs;
+			pool->slabs = slab;
+			pool->fresh = PRESENTATION_NODE_POOL_SLAB_SIZE;
+		}
+		node = &(pool->slabs->nodes[PRESENTATION_NODE_POOL_SLAB_SIZE - pool->fresh]);
+		pool->fresh--;
+	}
+	
+	pool->stats.used++;
+	if(pool->stats.used > pool->stats.peak){
+		pool->stats.peak = pool->stats.used;
+	}
+	
+	return node;
+}
+
+
+/*********	Give back a node to the pool	***********/
+void presentationNodePool_release(tPresentationNodePool* pool, tPresentationQueueNode* node) {
+	//Check preconditions
+	assert(pool != NULL);
+	assert(node != NULL);
+	
+	//the node is added to the free list
+	node->next = pool->freeList;
+	pool->freeList = node;
+	pool->stats.used--;
+}
+
+
+/*********	Get the statistics of a pool of queue nodes	***********/
+tPresentationNodePoolStats presentationNodePool_getStats(tPresentationNodePool* pool) {
+	//Check preconditions
+	assert(pool != NULL);
+	
+	return pool->stats;
+}
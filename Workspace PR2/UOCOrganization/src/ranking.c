@@ -0,0 +1,318 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "ranking.h"
+
+// Initialize the ranking
+void ranking_init(tRanking* ranking) {
+    // Verify pre conditions
+    assert(ranking != NULL);
+
+    // The arrays are allocated with the first score
+    ranking->topics = NULL;
+    ranking->topicsCapacity = 0;
+    ranking->organizations = NULL;
+    ranking->organizationTopics = NULL;
+    ranking->organizationsCapacity = 0;
+    ranking->organizationTopicsArray = NULL;
+    ranking->organizationTopicsCount = 0;
+    ranking->organizationTopicsCapacity = 0;
+    ranking->slots = NULL;
+    ranking->capacity = 0;
+    ranking->count = 0;
+}
+
+// Remove the memory used by the ranking
+void ranking_free(tRanking* ranking) {
+    // Verify pre conditions
+    assert(ranking != NULL);
+
+    if(ranking->topics != NULL) {
+        free(ranking->topics);
+    }
+    if(ranking->organizations != NULL) {
+        free(ranking->organizations);
+    }
+    if(ranking->organizationTopics != NULL) {
+        free(ranking->organizationTopics);
+    }
+    if(ranking->organizationTopicsArray != NULL) {
+        free(ranking->organizationTopicsArray);
+    }
+    if(ranking->slots != NULL) {
+        free(ranking->slots);
+    }
+    ranking_init(ranking);
+}
+
+// Compute the hash value of a pair of identifiers
+static unsigned int ranking_hash(unsigned int topicId, unsigned int organizationId) {
+    // Multiplicative hashing of each identifier, mixed together
+    return (topicId * 2654435761u) ^ (organizationId * 2246822519u);
+}
+
+// Get the slot of an organization on a topic, or the empty slot where it has to be stored
+static tRankingSlot* ranking_findSlot(tRankingSlot* slots, unsigned int capacity, unsigned int topicId, unsigned int organizationId) {
+    unsigned int i;
+
+    i = ranking_hash(topicId, organizationId) & (capacity - 1);
+    while(slots[i].organizationId != 0 && (slots[i].topicId != topicId || slots[i].organizationId != organizationId)) {
+        i = (i + 1) & (capacity - 1);
+    }
+
+    return &(slots[i]);
+}
+
+// Make room for one more organization score, keeping the load factor under 1/2
+static tError ranking_grow(tRanking* ranking) {
+    tRankingSlot* slots;
+    unsigned int capacity, i;
+
+    if(ranking->count + 1 <= ranking->capacity / 2) {
+        return OK;
+    }
+
+    capacity = (ranking->capacity == 0) ? RANKING_MIN_CAPACITY : ranking->capacity * 2;
+    slots = (tRankingSlot*) calloc(capacity, sizeof(tRankingSlot));
+    if(slots == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    // Move the current scores to the new slots
+    for(i=0; i<ranking->capacity; i++) {
+        if(ranking->slots[i].organizationId != 0) {
+            *ranking_findSlot(slots, capacity, ranking->slots[i].topicId, ranking->slots[i].organizationId) = ranking->slots[i];
+        }
+    }
+
+    if(ranking->slots != NULL) {
+        free(ranking->slots);
+    }
+    ranking->slots = slots;
+    ranking->capacity = capacity;
+
+    return OK;
+}
+
+// Make room for the given identifier on an array indexed by identifiers
+static tError ranking_growArray(void** array, unsigned int* arrayCapacity, size_t elementSize, unsigned int id) {
+    char* elements;
+    unsigned int capacity;
+
+    if(id < *arrayCapacity) {
+        return OK;
+    }
+
+    // The array is doubled until the identifier fits, and the new elements are empty
+    capacity = (*arrayCapacity == 0) ? RANKING_MIN_CAPACITY : *arrayCapacity;
+    while(capacity <= id) {
+        capacity = capacity * 2;
+    }
+    elements = (char*) realloc(*array, capacity * elementSize);
+    if(elements == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    memset(elements + *arrayCapacity * elementSize, 0, (capacity - *arrayCapacity) * elementSize);
+    *array = elements;
+    *arrayCapacity = capacity;
+
+    return OK;
+}
+
+// Add a topic at the end of the list of topics of an organization
+static tError ranking_addTopic(tRanking* ranking, unsigned int topicId, unsigned int organizationId) {
+    tRankingTopic* topics;
+    tRankingTopicList* list;
+    unsigned int capacity;
+
+    // The array of topics of the organizations grows geometrically
+    if(ranking->organizationTopicsCount == ranking->organizationTopicsCapacity) {
+        capacity = (ranking->organizationTopicsCapacity == 0) ? RANKING_MIN_CAPACITY : ranking->organizationTopicsCapacity * 2;
+        topics = (tRankingTopic*) realloc(ranking->organizationTopicsArray, capacity * sizeof(tRankingTopic));
+        if(topics == NULL) {
+            return ERR_MEMORY_ERROR;
+        }
+        ranking->organizationTopicsArray = topics;
+        ranking->organizationTopicsCapacity = capacity;
+    }
+    ranking->organizationTopicsArray[ranking->organizationTopicsCount].topicId = topicId;
+    ranking->organizationTopicsArray[ranking->organizationTopicsCount].next = 0;
+    ranking->organizationTopicsCount++;
+
+    list = &(ranking->organizationTopics[organizationId]);
+    if(list->last == 0) {
+        list->first = ranking->organizationTopicsCount;
+    } else {
+        ranking->organizationTopicsArray[list->last - 1].next = ranking->organizationTopicsCount;
+    }
+    list->last = ranking->organizationTopicsCount;
+
+    return OK;
+}
+
+// Add the score of a presentation of an organization on a topic
+tError ranking_add(tRanking* ranking, unsigned int topicId, unsigned int organizationId, double score) {
+    tTopicRanking* topic;
+    tRankingSlot* slot;
+    tScoreStats* stats;
+    unsigned int capacity;
+
+    // Verify pre conditions
+    assert(ranking != NULL);
+    assert(topicId != 0);
+    assert(organizationId != 0);
+
+    // Both arrays of the organizations are grown to the same capacity
+    capacity = ranking->organizationsCapacity;
+    if(ranking_growArray((void**) &(ranking->topics), &(ranking->topicsCapacity), sizeof(tTopicRanking), topicId) != OK
+        || ranking_growArray((void**) &(ranking->organizationTopics), &capacity, sizeof(tRankingTopicList), organizationId) != OK
+        || ranking_growArray((void**) &(ranking->organizations), &(ranking->organizationsCapacity), sizeof(tScoreStats), organizationId) != OK
+        || ranking_grow(ranking) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    // Update the aggregates of the organization
+    stats = &(ranking->organizations[organizationId]);
+    if(stats->count == 0 || score < stats->min) {
+        stats->min = score;
+    }
+    if(stats->count == 0 || score > stats->max) {
+        stats->max = score;
+    }
+    stats->sum += score;
+    stats->count++;
+
+    // Keep the best score of the organization on the topic. The first score on a topic adds it to the topics of the organization.
+    slot = ranking_findSlot(ranking->slots, ranking->capacity, topicId, organizationId);
+    if(slot->organizationId == 0) {
+        if(ranking_addTopic(ranking, topicId, organizationId) != OK) {
+            return ERR_MEMORY_ERROR;
+        }
+        slot->topicId = topicId;
+        slot->organizationId = organizationId;
+        slot->best = score;
+        ranking->count++;
+    } else if(score > slot->best) {
+        slot->best = score;
+    }
+
+    // Update the best score of the topic. The runner up is always the best score of the organizations different from the best one.
+    topic = &(ranking->topics[topicId]);
+    if(!topic->used) {
+        topic->used = true;
+        topic->best = score;
+        topic->bestOrganizationId = organizationId;
+        topic->hasRunnerUp = false;
+    } else if(organizationId == topic->bestOrganizationId) {
+        if(score > topic->best) {
+            topic->best = score;
+        }
+    } else if(score > topic->best) {
+        // The previous best organization becomes the runner up
+        topic->runnerUp = topic->best;
+        topic->hasRunnerUp = true;
+        topic->best = score;
+        topic->bestOrganizationId = organizationId;
+    } else if(!topic->hasRunnerUp || score > topic->runnerUp) {
+        topic->runnerUp = score;
+        topic->hasRunnerUp = true;
+    }
+
+    return OK;
+}
+
+// Get the best score of an organization on a topic. Returns false if the organization has no presentations on the topic.
+bool ranking_getBest(tRanking* ranking, unsigned int topicId, unsigned int organizationId, double* best) {
+    tRankingSlot* slot;
+
+    // Verify pre conditions
+    assert(ranking != NULL);
+    assert(best != NULL);
+
+    if(ranking->count == 0 || organizationId == 0) {
+        return false;
+    }
+
+    slot = ranking_findSlot(ranking->slots, ranking->capacity, topicId, organizationId);
+    if(slot->organizationId == 0) {
+        return false;
+    }
+    *best = slot->best;
+
+    return true;
+}
+
+// Get the score aggregates of an organization. Returns false if the organization has no presentations.
+bool ranking_getStats(tRanking* ranking, unsigned int organizationId, tScoreStats* stats) {
+    // Verify pre conditions
+    assert(ranking != NULL);
+    assert(stats != NULL);
+
+    if(organizationId == 0 || organizationId >= ranking->organizationsCapacity || ranking->organizations[organizationId].count == 0) {
+        memset(stats, 0, sizeof(tScoreStats));
+        return false;
+    }
+    *stats = ranking->organizations[organizationId];
+
+    return true;
+}
+
+// Get if an organization wins on a topic: 3 if it has the best score, 1 if it draws, 0 otherwise, or ERR_NOT_EXISTS if the topic has no presentations
+int ranking_getWins(tRanking* ranking, unsigned int topicId, unsigned int organizationId) {
+    tTopicRanking* topic;
+    double best;
+
+    // Verify pre conditions
+    assert(ranking != NULL);
+
+    if(topicId == 0 || topicId >= ranking->topicsCapacity || !ranking->topics[topicId].used) {
+        return ERR_NOT_EXISTS;
+    }
+    topic = &(ranking->topics[topicId]);
+
+    // The organization has no presentations on the topic
+    if(!ranking_getBest(ranking, topicId, organizationId, &best)) {
+        return 0;
+    }
+
+    // The best organization is compared with the runner up, and the other ones with the best score
+    if(organizationId == topic->bestOrganizationId) {
+        if(!topic->hasRunnerUp || best > topic->runnerUp) {
+            return 3;
+        }
+        return 1;
+    }
+    if(best == topic->best) {
+        return 1;
+    }
+
+    return 0;
+}
+
+// Place a cursor on the first topic where an organization has presentations
+void ranking_beginTopics(tRanking* ranking, unsigned int organizationId, tRankingTopicIterator* it) {
+    // Verify pre conditions
+    assert(ranking != NULL);
+    assert(it != NULL);
+
+    it->ranking = ranking;
+    it->position = (organizationId != 0 && organizationId < ranking->organizationsCapacity) ? ranking->organizationTopics[organizationId].first : 0;
+}
+
+// Move a cursor to the next topic
+void ranking_nextTopic(tRankingTopicIterator* it) {
+    // Verify pre conditions
+    assert(it != NULL);
+
+    if(it->position != 0) {
+        it->position = it->ranking->organizationTopicsArray[it->position - 1].next;
+    }
+}
+
+// Get the identifier of the topic of a cursor, or 0 after the last one
+unsigned int ranking_getTopic(tRankingTopicIterator* it) {
+    // Verify pre conditions
+    assert(it != NULL);
+
+    return (it->position != 0) ? it->ranking->organizationTopicsArray[it->position - 1].topicId : 0;
+}
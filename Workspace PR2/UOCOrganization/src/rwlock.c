@@ -0,0 +1,77 @@
+#include <assert.h>
+#include "rwlock.h"
+
+// Initialize the lock
+tError rwLock_init(tRWLock* lock) {
+    // Verify pre conditions
+    assert(lock != NULL);
+
+#ifdef _WIN32
+    InitializeSRWLock(&(lock->lock));
+#else
+    if(pthread_rwlock_init(&(lock->lock), NULL) != 0) {
+        return ERR_MEMORY_ERROR;
+    }
+#endif
+
+    return OK;
+}
+
+// Remove the resources of the lock, which must not be held
+void rwLock_free(tRWLock* lock) {
+    // Verify pre conditions
+    assert(lock != NULL);
+
+    // Slim locks have no resources to release
+#ifndef _WIN32
+    pthread_rwlock_destroy(&(lock->lock));
+#endif
+}
+
+// Take the lock for reading, waiting for the writer that holds it, if any
+void rwLock_readLock(tRWLock* lock) {
+    // Verify pre conditions
+    assert(lock != NULL);
+
+#ifdef _WIN32
+    AcquireSRWLockShared(&(lock->lock));
+#else
+    pthread_rwlock_rdlock(&(lock->lock));
+#endif
+}
+
+// Release the lock taken for reading
+void rwLock_readUnlock(tRWLock* lock) {
+    // Verify pre conditions
+    assert(lock != NULL);
+
+#ifdef _WIN32
+    ReleaseSRWLockShared(&(lock->lock));
+#else
+    pthread_rwlock_unlock(&(lock->lock));
+#endif
+}
+
+// Take the lock for writing, waiting for all the readers and the writer that hold it
+void rwLock_writeLock(tRWLock* lock) {
+    // Verify pre conditions
+    assert(lock != NULL);
+
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&(lock->lock));
+#else
+    pthread_rwlock_wrlock(&(lock->lock));
+#endif
+}
+
+// Release the lock taken for writing
+void rwLock_writeUnlock(tRWLock* lock) {
+    // Verify pre conditions
+    assert(lock != NULL);
+
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&(lock->lock));
+#else
+    pthread_rwlock_unlock(&(lock->lock));
+#endif
+}
@@ -0,0 +1,171 @@
+#include <assert.h>
+#include "shared.h"
+
+// Initialize the shared congress
+tError sharedCongress_init(tSharedCongress* object, char* name) {
+    return sharedCongress_initQueueType(object, name, PRESENTATION_QUEUE_LIST);
+}
+
+// Initialize the shared congress, storing the presentations on the given type of queue
+tError sharedCongress_initQueueType(tSharedCongress* object, char* name, tPresentationQueueType queueType) {
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(name != NULL);
+
+    if(rwLock_init(&(object->lock)) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+    congress_initQueueType(&(object->congress), name, queueType);
+
+    return OK;
+}
+
+// Remove all data for a shared congress. No other thread can use it.
+void sharedCongress_free(tSharedCongress* object) {
+    // Verify pre conditions
+    assert(object != NULL);
+
+    congress_free(&(object->congress));
+    rwLock_free(&(object->lock));
+}
+
+// Register a new organization to the congress
+tError sharedCongress_registerOrganization(tSharedCongress* object, tOrganization* organization) {
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_writeLock(&(object->lock));
+    err = congress_registerOrganization(&(object->congress), organization);
+    rwLock_writeUnlock(&(object->lock));
+
+    return err;
+}
+
+// Remove an organization from the congress
+tError sharedCongress_removeOrganization(tSharedCongress* object, tOrganization* organization) {
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_writeLock(&(object->lock));
+    err = congress_removeOrganization(&(object->congress), organization);
+    rwLock_writeUnlock(&(object->lock));
+
+    return err;
+}
+
+// Get all the guests of the congress
+tError sharedCongress_getGuests(tSharedCongress* object, tGuestTable* guests) {
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_readLock(&(object->lock));
+    err = congress_getGuests(&(object->congress), guests);
+    rwLock_readUnlock(&(object->lock));
+
+    return err;
+}
+
+// Add a new presentation
+tError sharedCongress_addPresentation(tSharedCongress* object, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic) {
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_writeLock(&(object->lock));
+    err = congress_addPresentation(&(object->congress), organization_name, score, presentationTitle, presentationTopic);
+    rwLock_writeUnlock(&(object->lock));
+
+    return err;
+}
+
+// Add many presentations at once, taking the lock once for all of them. Returns the number of presentations added.
+unsigned int sharedCongress_addPresentationsBatch(tSharedCongress* object, const tPresentationData* presentations, unsigned int count, tError* errors) {
+    unsigned int added;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_writeLock(&(object->lock));
+    added = congress_addPresentationsBatch(&(object->congress), presentations, count, errors);
+    rwLock_writeUnlock(&(object->lock));
+
+    return added;
+}
+
+// Get if an organization wins on a topic
+int sharedCongress_getOrganizationWins(tSharedCongress* object, const char* organization_name, const char* topic) {
+    int wins;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    // The queries only read the congress: the ranking, the intern table and the organizations are not changed by them
+    rwLock_readLock(&(object->lock));
+    wins = congress_getOrganizationWins(&(object->congress), organization_name, topic);
+    rwLock_readUnlock(&(object->lock));
+
+    return wins;
+}
+
+// Get the total score for an organization
+double sharedCongress_getOrganizationScore(tSharedCongress* object, const char* organization_name) {
+    double score;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_readLock(&(object->lock));
+    score = congress_getOrganizationScore(&(object->congress), organization_name);
+    rwLock_readUnlock(&(object->lock));
+
+    return score;
+}
+
+// Get the average score for an organization
+double sharedCongress_getOrganizationAverage(tSharedCongress* object, const char* organization_name) {
+    double average;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_readLock(&(object->lock));
+    average = congress_getOrganizationAverage(&(object->congress), organization_name);
+    rwLock_readUnlock(&(object->lock));
+
+    return average;
+}
+
+// Get the number, total, minimum and maximum of the scores of an organization, all of them from the same state of the congress
+tError sharedCongress_getOrganizationStats(tSharedCongress* object, const char* organization_name, tScoreStats* stats) {
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_readLock(&(object->lock));
+    err = congress_getOrganizationStats(&(object->congress), organization_name, stats);
+    rwLock_readUnlock(&(object->lock));
+
+    return err;
+}
+
+// Get a queue with a copy of all the presentations for an organization. Views are not available, as they would not be protected by the lock.
+tError sharedCongress_getOrganizationPresentations(tSharedCongress* object, const char* organization_name, tPresentationQueue* presentations) {
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+
+    rwLock_readLock(&(object->lock));
+    err = congress_getOrganizationPresentations(&(object->congress), organization_name, presentations);
+    rwLock_readUnlock(&(object->lock));
+
+    return err;
+}
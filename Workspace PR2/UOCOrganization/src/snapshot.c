@@ -0,0 +1,443 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "snapshot.h"
+
+// Snapshot file mapped on memory
+typedef struct {
+    const char* data;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} tSnapshotFile;
+
+// Map a snapshot file on memory, for reading
+static tError snapshot_map(const char* path, tSnapshotFile* file) {
+#ifdef _WIN32
+    LARGE_INTEGER size;
+
+    file->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file->file == INVALID_HANDLE_VALUE) {
+        return ERR_CANNOT_READ;
+    }
+    if(!GetFileSizeEx(file->file, &size)) {
+        CloseHandle(file->file);
+        return ERR_CANNOT_READ;
+    }
+    // An empty file cannot be mapped, and it is not a valid snapshot either
+    if(size.QuadPart < (LONGLONG) sizeof(tSnapshotHeader)) {
+        CloseHandle(file->file);
+        return ERR_INVALID;
+    }
+    file->size = (size_t) size.QuadPart;
+    file->mapping = CreateFileMappingA(file->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(file->mapping == NULL) {
+        CloseHandle(file->file);
+        return ERR_CANNOT_READ;
+    }
+    file->data = (const char*) MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0);
+    if(file->data == NULL) {
+        CloseHandle(file->mapping);
+        CloseHandle(file->file);
+        return ERR_CANNOT_READ;
+    }
+#else
+    struct stat info;
+    void* data;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        return ERR_CANNOT_READ;
+    }
+    if(fstat(fd, &info) != 0) {
+        close(fd);
+        return ERR_CANNOT_READ;
+    }
+    // An empty file cannot be mapped, and it is not a valid snapshot either
+    if(info.st_size < (off_t) sizeof(tSnapshotHeader)) {
+        close(fd);
+        return ERR_INVALID;
+    }
+    file->size = (size_t) info.st_size;
+    data = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping is kept after closing the file
+    close(fd);
+    if(data == MAP_FAILED) {
+        return ERR_CANNOT_READ;
+    }
+    file->data = (const char*) data;
+#endif
+
+    return OK;
+}
+
+// Remove the mapping of a snapshot file
+static void snapshot_unmap(tSnapshotFile* file) {
+#ifdef _WIN32
+    UnmapViewOfFile(file->data);
+    CloseHandle(file->mapping);
+    CloseHandle(file->file);
+#else
+    munmap((void*) file->data, file->size);
+#endif
+    file->data = NULL;
+    file->size = 0;
+}
+
+// Get the next array of a mapped snapshot, or NULL if the file is too short
+static const void* snapshot_section(tSnapshotFile* file, size_t* position, uint32_t count, size_t elementSize) {
+    const void* section;
+
+    if(count > (file->size - *position) / elementSize) {
+        return NULL;
+    }
+    section = file->data + *position;
+    *position += count * elementSize;
+
+    return section;
+}
+
+// Check the identifier of a string of a snapshot
+static bool snapshot_validString(tSnapshotHeader* header, uint32_t id) {
+    return id != 0 && id <= header->strings;
+}
+
+// Add a string to the strings of a snapshot being written, setting err if there is no memory
+static uint32_t snapshot_addString(tInternTable* strings, const char* str, tError* err) {
+    unsigned int id;
+
+    id = internTable_add(strings, str);
+    if(id == INTERN_NO_ID) {
+        *err = ERR_MEMORY_ERROR;
+    }
+
+    return id;
+}
+
+// Compare the addresses of two guest tables, to sort them
+static int snapshot_compareGuestTables(const void* a, const void* b) {
+    const tGuestTable* table1 = *(const tGuestTable* const*) a;
+    const tGuestTable* table2 = *(const tGuestTable* const*) b;
+
+    return (table1 > table2) - (table1 < table2);
+}
+
+// Write the congress to a snapshot file. The presentations of organizations that are not registered anymore are not written.
+tError congress_save(tCongress* object, const char* path) {
+    tSnapshotHeader header;
+    tSnapshotPresentation* presentations;
+    tSnapshotOrganization* organizations;
+    tSnapshotGuestTable* guestTables;
+    tSnapshotGuest* guests;
+    uint32_t* offsets;
+    tGuestTable** tables;
+    tGuestTable** found;
+    unsigned int* positions;
+    tArena arena;
+    tInternTable strings;
+    tPresentationQueueIterator it;
+    tPresentation* p;
+    tOrganization* organization;
+    const char* str;
+    unsigned int i, j, id, count;
+    FILE* file;
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(path != NULL);
+
+    // The strings are written once, identified by their position on a temporary intern table
+    err = OK;
+    arena_init(&arena);
+    internTable_init(&strings, &arena);
+    memset(&header, 0, sizeof(tSnapshotHeader));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.queueType = object->presentations.type;
+    header.name = snapshot_addString(&strings, object->name, &err);
+
+    count = 0;
+    for(presentationQueue_begin(&object->presentations, &it); presentationQueue_get(&it) != NULL; presentationQueue_next(&it)) {
+        count++;
+    }
+    presentations = (tSnapshotPresentation*) malloc((count + 1) * sizeof(tSnapshotPresentation));
+    organizations = (tSnapshotOrganization*) malloc((object->organizations->size + 1) * sizeof(tSnapshotOrganization));
+    tables = (tGuestTable**) malloc((object->organizations->size + 1) * sizeof(tGuestTable*));
+    positions = (unsigned int*) calloc(object->names.size + 1, sizeof(unsigned int));
+    guestTables = NULL;
+    guests = NULL;
+    offsets = NULL;
+    if(presentations == NULL || organizations == NULL || tables == NULL || positions == NULL) {
+        err = ERR_MEMORY_ERROR;
+    }
+
+    // The organizations sharing a table of guests point to the same guest table record. The tables are sorted by address, so each one is found with a binary search.
+    for(i=0; err == OK && i<object->organizations->size; i++) {
+        tables[i] = object->organizations->elements[i].guests;
+    }
+    if(err == OK && object->organizations->size > 0) {
+        qsort(tables, object->organizations->size, sizeof(tGuestTable*), snapshot_compareGuestTables);
+    }
+    for(i=0; err == OK && i<object->organizations->size; i++) {
+        if(i == 0 || tables[i] != tables[header.guestTables - 1]) {
+            tables[header.guestTables] = tables[i];
+            header.guests += tables[i]->size;
+            header.guestTables++;
+        }
+    }
+    for(i=0; err == OK && i<object->organizations->size; i++) {
+        organization = &(object->organizations->elements[i]);
+        found = (tGuestTable**) bsearch(&(organization->guests), tables, header.guestTables, sizeof(tGuestTable*), snapshot_compareGuestTables);
+        assert(found != NULL);
+        organizations[i].name = snapshot_addString(&strings, organization->name, &err);
+        organizations[i].guestTable = found - tables;
+        // The presentations find their organization by the identifier of its name on the congress
+        id = internTable_find(&object->names, organization->name);
+        if(id != INTERN_NO_ID) {
+            positions[id] = i + 1;
+        }
+    }
+    header.organizations = object->organizations->size;
+
+    if(err == OK) {
+        guestTables = (tSnapshotGuestTable*) malloc((header.guestTables + 1) * sizeof(tSnapshotGuestTable));
+        guests = (tSnapshotGuest*) malloc((header.guests + 1) * sizeof(tSnapshotGuest));
+        if(guestTables == NULL || guests == NULL) {
+            err = ERR_MEMORY_ERROR;
+        }
+    }
+    count = 0;
+    for(i=0; err == OK && i<header.guestTables; i++) {
+        guestTables[i].first = count;
+        guestTables[i].count = tables[i]->size;
+        for(j=0; j<tables[i]->size; j++) {
+            guests[count].username = snapshot_addString(&strings, tables[i]->elements[j].username, &err);
+            guests[count].name = snapshot_addString(&strings, tables[i]->elements[j].name, &err);
+            guests[count].mail = snapshot_addString(&strings, tables[i]->elements[j].mail, &err);
+            count++;
+        }
+    }
+
+    for(presentationQueue_begin(&object->presentations, &it); err == OK && (p = presentationQueue_get(&it)) != NULL; presentationQueue_next(&it)) {
+        if(p->organizationId == INTERN_NO_ID || p->organizationId > object->names.size || positions[p->organizationId] == 0) {
+            continue;
+        }
+        presentations[header.presentations].score = p->score;
+        presentations[header.presentations].organization = positions[p->organizationId] - 1;
+        presentations[header.presentations].title = snapshot_addString(&strings, p->presentationTitle, &err);
+        presentations[header.presentations].topic = snapshot_addString(&strings, p->presentationTopic, &err);
+        presentations[header.presentations].reserved = 0;
+        header.presentations++;
+    }
+
+    // The offsets of the strings follow from their lengths
+    if(err == OK) {
+        header.strings = strings.size;
+        offsets = (uint32_t*) malloc((header.strings + 1) * sizeof(uint32_t));
+        if(offsets == NULL) {
+            err = ERR_MEMORY_ERROR;
+        }
+    }
+    for(i=0; err == OK && i<header.strings; i++) {
+        offsets[i] = header.stringsSize;
+        header.stringsSize += strlen(internTable_get(&strings, i + 1)) + 1;
+    }
+
+    // Write all the arrays, in the order of the format
+    if(err == OK) {
+        file = fopen(path, "wb");
+        if(file == NULL) {
+            err = ERR_CANNOT_WRITE;
+        } else {
+            if(fwrite(&header, sizeof(tSnapshotHeader), 1, file) != 1
+                || fwrite(presentations, sizeof(tSnapshotPresentation), header.presentations, file) != header.presentations
+                || fwrite(organizations, sizeof(tSnapshotOrganization), header.organizations, file) != header.organizations
+                || fwrite(guestTables, sizeof(tSnapshotGuestTable), header.guestTables, file) != header.guestTables
+                || fwrite(guests, sizeof(tSnapshotGuest), header.guests, file) != header.guests
+                || fwrite(offsets, sizeof(uint32_t), header.strings, file) != header.strings) {
+                err = ERR_CANNOT_WRITE;
+            }
+            for(i=0; err == OK && i<header.strings; i++) {
+                str = internTable_get(&strings, i + 1);
+                if(fwrite(str, 1, strlen(str) + 1, file) != strlen(str) + 1) {
+                    err = ERR_CANNOT_WRITE;
+                }
+            }
+            if(fclose(file) != 0 && err == OK) {
+                err = ERR_CANNOT_WRITE;
+            }
+        }
+    }
+
+    free(presentations);
+    free(organizations);
+    free(tables);
+    free(positions);
+    free(guestTables);
+    free(guests);
+    free(offsets);
+    internTable_free(&strings);
+    arena_free(&arena);
+
+    return err;
+}
+
+// Check that all the records of a mapped snapshot point to valid positions and strings
+static bool snapshot_validate(tSnapshotHeader* header, const tSnapshotPresentation* presentations, const tSnapshotOrganization* organizations,
+                              const tSnapshotGuestTable* guestTables, const tSnapshotGuest* guests, const uint32_t* offsets, const char* bytes) {
+    uint32_t i;
+
+    if(header->magic != SNAPSHOT_MAGIC || header->version != SNAPSHOT_VERSION || header->queueType > PRESENTATION_QUEUE_RING || !snapshot_validString(header, header->name)) {
+        return false;
+    }
+
+    // Each string starts inside the string bytes, and the last one ends them, so all of them are terminated
+    if(header->stringsSize == 0 || bytes[header->stringsSize - 1] != '\0') {
+        return false;
+    }
+    for(i=0; i<header->strings; i++) {
+        if(offsets[i] >= header->stringsSize) {
+            return false;
+        }
+    }
+
+    for(i=0; i<header->guests; i++) {
+        if(!snapshot_validString(header, guests[i].username) || !snapshot_validString(header, guests[i].name) || !snapshot_validString(header, guests[i].mail)) {
+            return false;
+        }
+    }
+    for(i=0; i<header->guestTables; i++) {
+        if(guestTables[i].first > header->guests || guestTables[i].count > header->guests - guestTables[i].first) {
+            return false;
+        }
+    }
+    for(i=0; i<header->organizations; i++) {
+        if(!snapshot_validString(header, organizations[i].name) || organizations[i].guestTable >= header->guestTables) {
+            return false;
+        }
+    }
+    for(i=0; i<header->presentations; i++) {
+        if(presentations[i].organization >= header->organizations || !snapshot_validString(header, presentations[i].title) || !snapshot_validString(header, presentations[i].topic)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Initialize a congress with the data of a snapshot file. The file is mapped on memory, and the strings are copied to the arena of the congress with a single allocation.
+tError congress_load(tCongress* object, const char* path) {
+    tSnapshotFile file;
+    tSnapshotHeader header;
+    const tSnapshotPresentation* presentations;
+    const tSnapshotOrganization* organizations;
+    const tSnapshotGuestTable* guestTables;
+    const tSnapshotGuest* guests;
+    const uint32_t* offsets;
+    const char* bytes;
+    char* strings;
+    tGuest* guestArray;
+    tPresentationData* rows;
+    tOrganization organization;
+    size_t position;
+    uint32_t i;
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(path != NULL);
+
+    err = snapshot_map(path, &file);
+    if(err != OK) {
+        return err;
+    }
+
+    // Locate the arrays of the file
+    memcpy(&header, file.data, sizeof(tSnapshotHeader));
+    position = sizeof(tSnapshotHeader);
+    presentations = (const tSnapshotPresentation*) snapshot_section(&file, &position, header.presentations, sizeof(tSnapshotPresentation));
+    organizations = (const tSnapshotOrganization*) snapshot_section(&file, &position, header.organizations, sizeof(tSnapshotOrganization));
+    guestTables = (const tSnapshotGuestTable*) snapshot_section(&file, &position, header.guestTables, sizeof(tSnapshotGuestTable));
+    guests = (const tSnapshotGuest*) snapshot_section(&file, &position, header.guests, sizeof(tSnapshotGuest));
+    offsets = (const uint32_t*) snapshot_section(&file, &position, header.strings, sizeof(uint32_t));
+    bytes = (const char*) snapshot_section(&file, &position, header.stringsSize, 1);
+    if(presentations == NULL || organizations == NULL || guestTables == NULL || guests == NULL || offsets == NULL || bytes == NULL
+        || !snapshot_validate(&header, presentations, organizations, guestTables, guests, offsets, bytes)) {
+        snapshot_unmap(&file);
+        return ERR_INVALID;
+    }
+
+    // All the strings are copied to the arena of the congress at once
+    congress_initQueueType(object, (char*) bytes + offsets[header.name - 1], (tPresentationQueueType) header.queueType);
+    strings = (char*) arena_alloc(&object->strings, header.stringsSize);
+    guestArray = (tGuest*) malloc((header.guests + 1) * sizeof(tGuest));
+    rows = (tPresentationData*) malloc((header.presentations + 1) * sizeof(tPresentationData));
+    if(strings == NULL || guestArray == NULL || rows == NULL) {
+        err = ERR_MEMORY_ERROR;
+    } else {
+        memcpy(strings, bytes, header.stringsSize);
+    }
+
+    // The guests point to the strings of the arena, so the tables do not copy them
+    for(i=0; err == OK && i<header.guests; i++) {
+        guestArray[i].username = strings + offsets[guests[i].username - 1];
+        guestArray[i].name = strings + offsets[guests[i].name - 1];
+        guestArray[i].mail = strings + offsets[guests[i].mail - 1];
+    }
+    // The tables are added to the new congress in the order of the file, so their positions are the same
+    for(i=0; err == OK && i<header.guestTables; i++) {
+        if(congress_addGuestTable(object) == NULL) {
+            err = ERR_MEMORY_ERROR;
+        } else if(guestTable_addManyShared(object->guestTables[i], &(guestArray[guestTables[i].first]), guestTables[i].count) != OK) {
+            err = ERR_INVALID;
+        }
+    }
+
+    // The organizations are registered on the empty congress, whose index checks that their names are unique. Their names are the strings of the arena, so they are not copied. They take a new identifier when they are added.
+    if(err == OK) {
+        err = organizationTable_reserve(object->organizations, header.organizations);
+    }
+    for(i=0; err == OK && i<header.organizations; i++) {
+        organization.name = strings + offsets[organizations[i].name - 1];
+        organization.guests = object->guestTables[organizations[i].guestTable];
+        organization.id = 0;
+        organization.references = NULL;
+        err = congress_registerOrganizationShared(object, &organization);
+        if(err == ERR_DUPLICATED) {
+            err = ERR_INVALID;
+        }
+    }
+
+    // The presentations are added in a single batch, sharing the strings of the arena
+    for(i=0; err == OK && i<header.presentations; i++) {
+        rows[i].organizationName = strings + offsets[organizations[presentations[i].organization].name - 1];
+        rows[i].score = presentations[i].score;
+        rows[i].title = strings + offsets[presentations[i].title - 1];
+        rows[i].topic = strings + offsets[presentations[i].topic - 1];
+    }
+    if(err == OK && congress_addPresentationsBatchShared(object, rows, header.presentations, NULL) != header.presentations) {
+        err = ERR_MEMORY_ERROR;
+    }
+
+    free(guestArray);
+    free(rows);
+    snapshot_unmap(&file);
+    if(err != OK) {
+        congress_free(object);
+    }
+
+    return err;
+}
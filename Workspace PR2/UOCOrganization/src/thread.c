@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "thread.h"
+
+// Function and argument of a starting thread
+typedef struct {
+    tThreadFunction function;
+    void* arg;
+} tThreadStart;
+
+// Run the function of a thread
+static void thread_call(void* data) {
+    tThreadStart start;
+
+    start = *(tThreadStart*) data;
+    free(data);
+    start.function(start.arg);
+}
+
+// Entry point of the threads, with the signature of each system
+#ifdef _WIN32
+static DWORD WINAPI thread_run(LPVOID data) {
+    thread_call(data);
+    return 0;
+}
+#else
+static void* thread_run(void* data) {
+    thread_call(data);
+    return NULL;
+}
+#endif
+
+// Start a thread running function(arg)
+tError thread_start(tThread* thread, tThreadFunction function, void* arg) {
+    tThreadStart* start;
+    bool started;
+
+    // Verify pre conditions
+    assert(thread != NULL);
+    assert(function != NULL);
+
+    // The function and its argument are released by the new thread
+    start = (tThreadStart*) malloc(sizeof(tThreadStart));
+    if(start == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    start->function = function;
+    start->arg = arg;
+
+#ifdef _WIN32
+    thread->handle = CreateThread(NULL, 0, thread_run, start, 0, NULL);
+    started = (thread->handle != NULL);
+#else
+    started = (pthread_create(&(thread->handle), NULL, thread_run, start) == 0);
+#endif
+    if(!started) {
+        free(start);
+        return ERR_MEMORY_ERROR;
+    }
+
+    return OK;
+}
+
+// Wait for the end of a thread, and remove its resources
+void thread_join(tThread* thread) {
+    // Verify pre conditions
+    assert(thread != NULL);
+
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
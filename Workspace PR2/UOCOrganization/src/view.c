@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "view.h"
+
+// Initialize the index
+void presentationIndex_init(tPresentationIndex* index) {
+    // Verify pre conditions
+    assert(index != NULL);
+
+    // The views are allocated with the first presentation
+    index->organizations = NULL;
+    index->capacity = 0;
+}
+
+// Remove the memory used by the index. The presentations are not removed.
+void presentationIndex_free(tPresentationIndex* index) {
+    unsigned int i;
+
+    // Verify pre conditions
+    assert(index != NULL);
+
+    for(i=0; i<index->capacity; i++) {
+        if(index->organizations[i].elements != NULL) {
+            free(index->organizations[i].elements);
+        }
+    }
+    if(index->organizations != NULL) {
+        free(index->organizations);
+    }
+    presentationIndex_init(index);
+}
+
+// Remove all the presentations of the index, keeping its memory
+void presentationIndex_clear(tPresentationIndex* index) {
+    unsigned int i;
+
+    // Verify pre conditions
+    assert(index != NULL);
+
+    for(i=0; i<index->capacity; i++) {
+        index->organizations[i].size = 0;
+    }
+}
+
+// Make room for the organization with the given identifier
+static tError presentationIndex_grow(tPresentationIndex* index, unsigned int organizationId) {
+    tPresentationView* organizations;
+    unsigned int capacity;
+
+    if(organizationId < index->capacity) {
+        return OK;
+    }
+
+    // The array is doubled until the identifier fits, and the new views are empty
+    capacity = (index->capacity == 0) ? PRESENTATION_INDEX_MIN_CAPACITY : index->capacity;
+    while(capacity <= organizationId) {
+        capacity = capacity * 2;
+    }
+    organizations = (tPresentationView*) realloc(index->organizations, capacity * sizeof(tPresentationView));
+    if(organizations == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    memset(&(organizations[index->capacity]), 0, (capacity - index->capacity) * sizeof(tPresentationView));
+    index->organizations = organizations;
+    index->capacity = capacity;
+
+    return OK;
+}
+
+// Add a presentation of an organization to the index
+tError presentationIndex_add(tPresentationIndex* index, unsigned int organizationId, tPresentation* presentation) {
+    tPresentationView* view;
+    tPresentation** elements;
+    unsigned int capacity;
+
+    // Verify pre conditions
+    assert(index != NULL);
+    assert(organizationId != 0);
+    assert(presentation != NULL);
+
+    if(presentationIndex_grow(index, organizationId) != OK) {
+        return ERR_MEMORY_ERROR;
+    }
+
+    // The references of each organization are doubled when they are full
+    view = &(index->organizations[organizationId]);
+    if(view->size == view->capacity) {
+        capacity = (view->capacity == 0) ? PRESENTATION_INDEX_MIN_CAPACITY : view->capacity * 2;
+        elements = (tPresentation**) realloc(view->elements, capacity * sizeof(tPresentation*));
+        if(elements == NULL) {
+            return ERR_MEMORY_ERROR;
+        }
+        view->elements = elements;
+        view->capacity = capacity;
+    }
+    view->elements[view->size] = presentation;
+    view->size++;
+
+    return OK;
+}
+
+// Get the view of the presentations of an organization. It is empty if the organization has no presentations.
+void presentationIndex_getView(tPresentationIndex* index, unsigned int organizationId, tPresentationView* view) {
+    // Verify pre conditions
+    assert(index != NULL);
+    assert(view != NULL);
+
+    if(organizationId == 0 || organizationId >= index->capacity) {
+        view->elements = NULL;
+        view->size = 0;
+        view->capacity = 0;
+        return;
+    }
+    *view = index->organizations[organizationId];
+}
+
+// Get the number of presentations of a view
+unsigned int presentationView_size(tPresentationView view) {
+    return view.size;
+}
+
+// Get a presentation of a view, in the order they were added
+tPresentation* presentationView_get(tPresentationView view, unsigned int position) {
+    // Verify pre conditions
+    assert(position < view.size);
+
+    return view.elements[position];
+}
@@ -0,0 +1,790 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "wal.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+// Size of the header of a log file, and of the length and checksum around the fields of each record
+#define WAL_FILE_HEADER_SIZE 8
+#define WAL_RECORD_OVERHEAD 8
+
+// Send the written data of a file to the disk
+static int wal_sync(int fd) {
+#ifdef _WIN32
+    return _commit(fd);
+#else
+    return fsync(fd);
+#endif
+}
+
+// Cut a file to the given size, and place the file position at its end
+static int wal_truncate(int fd, long long size) {
+#ifdef _WIN32
+    if(_chsize_s(fd, size) != 0 || _lseeki64(fd, size, SEEK_SET) != size) {
+        return -1;
+    }
+#else
+    if(ftruncate(fd, (off_t) size) != 0 || lseek(fd, (off_t) size, SEEK_SET) != (off_t) size) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+// Write all the bytes, even if the system writes them in parts
+static bool wal_writeAll(int fd, const char* data, size_t length) {
+    int written;
+
+    while(length > 0) {
+        written = write(fd, data, (length > WAL_BUFFER_SIZE) ? WAL_BUFFER_SIZE : (unsigned int) length);
+        if(written <= 0) {
+            return false;
+        }
+        data += written;
+        length -= written;
+    }
+    return true;
+}
+
+// Checksum of the fields of a record (FNV-1a)
+static uint32_t wal_checksum(const char* data, size_t length) {
+    uint32_t checksum;
+    size_t i;
+
+    checksum = 2166136261u;
+    for(i=0; i<length; i++) {
+        checksum = (checksum ^ (unsigned char) data[i]) * 16777619u;
+    }
+    return checksum;
+}
+
+// Write the records waiting on the buffer. If the write fails, the part written is cut, so the records are written again by the next commit. If it cannot be cut, the log is not used anymore.
+static tError wal_write(tWal* wal) {
+    if(wal->failed) {
+        return ERR_CANNOT_WRITE;
+    }
+    if(wal->used == 0) {
+        return OK;
+    }
+    if(!wal_writeAll(wal->fd, wal->buffer, wal->used)) {
+        if(wal_truncate(wal->fd, wal->size) != 0) {
+            wal->failed = true;
+        }
+        return ERR_CANNOT_WRITE;
+    }
+    wal->size += wal->used;
+    wal->used = 0;
+
+    return OK;
+}
+
+// Write and sync the records waiting on the log
+tError wal_commit(tWal* wal) {
+    tError err;
+
+    // Verify pre conditions
+    assert(wal != NULL);
+
+    err = wal_write(wal);
+    if(err != OK) {
+        return err;
+    }
+
+    // Records written because the buffer was full are synced too. After a failed sync the state of the file is not known, so the log is not used anymore.
+    if(wal->pending > 0) {
+        if(wal_sync(wal->fd) != 0) {
+            wal->failed = true;
+            return ERR_CANNOT_WRITE;
+        }
+        wal->pending = 0;
+        wal->commits++;
+    }
+
+    return OK;
+}
+
+// Make room for a record on the buffer. The records on a full buffer are written, but they are synced with the rest of their group.
+static tError wal_reserve(tWal* wal, size_t size) {
+    char* buffer;
+    tError err;
+
+    if(wal->used + size <= wal->capacity) {
+        return OK;
+    }
+    err = wal_write(wal);
+    if(err != OK) {
+        return err;
+    }
+
+    if(size > wal->capacity) {
+        buffer = (char*) realloc(wal->buffer, size);
+        if(buffer == NULL) {
+            return ERR_MEMORY_ERROR;
+        }
+        wal->buffer = buffer;
+        wal->capacity = size;
+    }
+
+    return OK;
+}
+
+// Add a record to the buffer of the log, with a value of valueSize bytes before its strings. Returns an error if the record is not added.
+static tError wal_add(tWal* wal, tWalRecordType type, const void* value, size_t valueSize, const char** strings, unsigned int count) {
+    size_t size, length;
+    uint32_t header, checksum;
+    char* p;
+    char* fields;
+    unsigned int i;
+    tError err;
+
+    if(wal->failed) {
+        return ERR_CANNOT_WRITE;
+    }
+    size = 1 + valueSize;
+    for(i=0; i<count; i++) {
+        size += strlen(strings[i]) + 1;
+    }
+    if(size > WAL_MAX_RECORD_SIZE) {
+        return ERR_INVALID;
+    }
+    err = wal_reserve(wal, size + WAL_RECORD_OVERHEAD);
+    if(err != OK) {
+        return err;
+    }
+
+    // The values are copied byte by byte, as the fields are not aligned
+    p = wal->buffer + wal->used;
+    header = (uint32_t) size;
+    memcpy(p, &header, sizeof(uint32_t));
+    p += sizeof(uint32_t);
+    fields = p;
+    *p++ = (char) type;
+    if(valueSize > 0) {
+        memcpy(p, value, valueSize);
+        p += valueSize;
+    }
+    for(i=0; i<count; i++) {
+        length = strlen(strings[i]) + 1;
+        memcpy(p, strings[i], length);
+        p += length;
+    }
+    checksum = wal_checksum(fields, size);
+    memcpy(p, &checksum, sizeof(uint32_t));
+
+    wal->used += size + WAL_RECORD_OVERHEAD;
+    wal->pending++;
+
+    return OK;
+}
+
+// Commit the records waiting on the log when their group is complete
+static tError wal_endChange(tWal* wal) {
+    if(wal->pending >= wal->groupSize) {
+        return wal_commit(wal);
+    }
+
+    return OK;
+}
+
+// Compare the addresses of the guest tables of two entries, to sort them
+static int wal_compareGuestTables(const void* a, const void* b) {
+    const tGuestTable* table1 = ((const tWalGuestTable*) a)->table;
+    const tGuestTable* table2 = ((const tWalGuestTable*) b)->table;
+
+    return (table1 > table2) - (table1 < table2);
+}
+
+// Get the entry of a table of guests written to the log, or NULL if it is not there
+static tWalGuestTable* wal_findGuestTable(tWal* wal, tGuestTable* table) {
+    tWalGuestTable key;
+
+    if(wal->tablesCount == 0) {
+        return NULL;
+    }
+    key.table = table;
+
+    return (tWalGuestTable*) bsearch(&key, wal->tables, wal->tablesCount, sizeof(tWalGuestTable), wal_compareGuestTables);
+}
+
+// Store the number of a table of guests written to the log, keeping the entries sorted by address
+static tError wal_setGuestTable(tWal* wal, tGuestTable* table, uint32_t number) {
+    tWalGuestTable* entry;
+    tWalGuestTable* tables;
+    unsigned int pos, capacity;
+
+    entry = wal_findGuestTable(wal, table);
+    if(entry == NULL) {
+        if(wal->tablesCount == wal->tablesCapacity) {
+            capacity = (wal->tablesCapacity == 0) ? GUEST_TABLE_MIN_CAPACITY : wal->tablesCapacity * 2;
+            tables = (tWalGuestTable*) realloc(wal->tables, capacity * sizeof(tWalGuestTable));
+            if(tables == NULL) {
+                return ERR_MEMORY_ERROR;
+            }
+            wal->tables = tables;
+            wal->tablesCapacity = capacity;
+        }
+        for(pos=wal->tablesCount; pos>0 && wal->tables[pos - 1].table > table; pos--);
+        memmove(&(wal->tables[pos + 1]), &(wal->tables[pos]), (wal->tablesCount - pos) * sizeof(tWalGuestTable));
+        wal->tablesCount++;
+        entry = &(wal->tables[pos]);
+        entry->table = table;
+    }
+    entry->size = table->size;
+    entry->contentHash = table->contentHash;
+    entry->number = number;
+
+    return OK;
+}
+
+// Get the number of a table of guests on the log, adding the table to the log if it is not there, or if it changed since it was added
+static tError wal_addGuestTable(tWal* wal, tGuestTable* table, uint32_t* number) {
+    tWalGuestTable* entry;
+    const char* strings[3 * WAL_GUESTS_PER_RECORD];
+    unsigned int i, count;
+    tError err;
+
+    entry = wal_findGuestTable(wal, table);
+    if(entry != NULL && entry->size == table->size && entry->contentHash == table->contentHash) {
+        *number = entry->number;
+        return OK;
+    }
+
+    // The records of the table are committed with the record that uses it
+    err = wal_add(wal, WAL_RECORD_GUEST_TABLE, NULL, 0, NULL, 0);
+    if(err != OK) {
+        return err;
+    }
+    wal->lastTable++;
+    for(i=0; i<table->size; i+=count) {
+        for(count=0; count<WAL_GUESTS_PER_RECORD && i + count < table->size; count++) {
+            strings[3 * count] = table->elements[i + count].username;
+            strings[3 * count + 1] = table->elements[i + count].name;
+            strings[3 * count + 2] = table->elements[i + count].mail;
+        }
+        err = wal_add(wal, WAL_RECORD_ADD_GUESTS, NULL, 0, strings, 3 * count);
+        if(err != OK) {
+            return err;
+        }
+    }
+    *number = wal->lastTable;
+
+    return wal_setGuestTable(wal, table, wal->lastTable);
+}
+
+// Position of the log before the records of a change, to remove them if the change cannot be applied
+typedef struct {
+    long long position;
+    unsigned int pending;
+    uint32_t lastTable;
+} tWalMark;
+
+// Get the position of the log before the records of a change
+static void wal_mark(tWal* wal, tWalMark* mark) {
+    mark->position = wal->size + (long long) wal->used;
+    mark->pending = wal->pending;
+    mark->lastTable = wal->lastTable;
+}
+
+// Remove the records of a change added after a mark, from the buffer and from the file if a full buffer was written. The tables of guests added by them will be added again.
+static void wal_undo(tWal* wal, const tWalMark* mark) {
+    unsigned int i, count;
+
+    if(mark->position < wal->size) {
+        if(wal_truncate(wal->fd, mark->position) != 0) {
+            wal->failed = true;
+        } else {
+            wal->size = mark->position;
+        }
+        wal->used = 0;
+    } else {
+        wal->used = (size_t) (mark->position - wal->size);
+    }
+    wal->pending = mark->pending;
+
+    for(i=0, count=0; i<wal->tablesCount; i++) {
+        if(wal->tables[i].number <= mark->lastTable) {
+            wal->tables[count++] = wal->tables[i];
+        }
+    }
+    wal->tablesCount = count;
+    wal->lastTable = mark->lastTable;
+}
+
+// Read a string of the fields of a record, or NULL if it does not end inside them
+static const char* wal_readString(const char** p, const char* end) {
+    const char* str;
+    const char* last;
+
+    str = *p;
+    last = (const char*) memchr(str, '\0', end - str);
+    if(last == NULL) {
+        return NULL;
+    }
+    *p = last + 1;
+
+    return str;
+}
+
+// State of the replay of a log
+typedef struct {
+    tCongress* congress;
+    // Position on the tables of the congress of the first table created by the replay
+    unsigned int firstTable;
+    // Consecutive presentations waiting to be added at once. Their strings point to the buffer of the log.
+    tPresentationData batch[WAL_REPLAY_BATCH_SIZE];
+    tError errors[WAL_REPLAY_BATCH_SIZE];
+    unsigned int count;
+    // Guests of a record
+    tGuest guests[WAL_GUESTS_PER_RECORD];
+} tWalReplay;
+
+// Add the presentations waiting on the batch of the replay
+static tError wal_flushReplay(tWalReplay* replay) {
+    unsigned int i;
+
+    if(replay->count == 0) {
+        return OK;
+    }
+    congress_addPresentationsBatch(replay->congress, replay->batch, replay->count, replay->errors);
+
+    // Only the changes accepted by the congress are logged, so any other error is not expected
+    for(i=0; i<replay->count; i++) {
+        if(replay->errors[i] == ERR_MEMORY_ERROR) {
+            return ERR_MEMORY_ERROR;
+        }
+    }
+    replay->count = 0;
+
+    return OK;
+}
+
+// Apply the change of a record to the congress. Returns ERR_INVALID if the fields of the record are not valid.
+static tError wal_apply(tWalReplay* replay, const char* fields, size_t size) {
+    tCongress* object;
+    tOrganization organization;
+    tGuestTable* table;
+    const char* end;
+    const char* p;
+    const char* name;
+    const char* title;
+    const char* topic;
+    const char* strings[3];
+    uint32_t number;
+    unsigned int i, count;
+    double score;
+    tError err;
+
+    object = replay->congress;
+    end = fields + size;
+    p = fields + 1;
+    err = OK;
+    switch(fields[0]) {
+        case WAL_RECORD_REGISTER_ORGANIZATION:
+            if(end - p < (long) sizeof(uint32_t)) {
+                return ERR_INVALID;
+            }
+            memcpy(&number, p, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            name = wal_readString(&p, end);
+            if(name == NULL || p != end || number == 0 || number > object->guestTablesCount - replay->firstTable) {
+                return ERR_INVALID;
+            }
+            // The organization is copied by the congress, so its name can point to the record. Organizations already registered are skipped.
+            organization.name = (char*) name;
+            organization.guests = object->guestTables[replay->firstTable + number - 1];
+            organization.id = 0;
+            organization.references = NULL;
+            err = congress_registerOrganization(object, &organization);
+            if(err == ERR_DUPLICATED) {
+                err = OK;
+            }
+            break;
+        case WAL_RECORD_REMOVE_ORGANIZATION:
+            name = wal_readString(&p, end);
+            if(name == NULL || p != end) {
+                return ERR_INVALID;
+            }
+            // The presentations read before are added first, as they can belong to this organization
+            organization.name = (char*) name;
+            err = wal_flushReplay(replay);
+            if(err == OK) {
+                err = congress_removeOrganization(object, &organization);
+            }
+            if(err == ERR_NOT_FOUND) {
+                err = OK;
+            }
+            break;
+        case WAL_RECORD_ADD_PRESENTATION:
+            if(end - p < (long) sizeof(double)) {
+                return ERR_INVALID;
+            }
+            memcpy(&score, p, sizeof(double));
+            p += sizeof(double);
+            name = wal_readString(&p, end);
+            title = (name != NULL) ? wal_readString(&p, end) : NULL;
+            topic = (title != NULL) ? wal_readString(&p, end) : NULL;
+            if(topic == NULL || p != end) {
+                return ERR_INVALID;
+            }
+            replay->batch[replay->count].organizationName = name;
+            replay->batch[replay->count].score = score;
+            replay->batch[replay->count].title = title;
+            replay->batch[replay->count].topic = topic;
+            replay->count++;
+            if(replay->count == WAL_REPLAY_BATCH_SIZE) {
+                err = wal_flushReplay(replay);
+            }
+            break;
+        case WAL_RECORD_GUEST_TABLE:
+            if(p != end) {
+                return ERR_INVALID;
+            }
+            if(congress_addGuestTable(object) == NULL) {
+                err = ERR_MEMORY_ERROR;
+            }
+            break;
+        case WAL_RECORD_ADD_GUESTS:
+            if(object->guestTablesCount == replay->firstTable) {
+                return ERR_INVALID;
+            }
+            table = object->guestTables[object->guestTablesCount - 1];
+            // The guests are copied to the arena of the congress, and the table shares them
+            count = 0;
+            while(p != end) {
+                for(i=0; i<3; i++) {
+                    strings[i] = wal_readString(&p, end);
+                    if(strings[i] == NULL) {
+                        return ERR_INVALID;
+                    }
+                }
+                if(count == WAL_GUESTS_PER_RECORD) {
+                    return ERR_INVALID;
+                }
+                err = guest_initArena(&(replay->guests[count]), &(object->strings), strings[0], strings[1], strings[2]);
+                if(err == ERR_MEMORY_ERROR) {
+                    return err;
+                } else if(err == OK) {
+                    count++;
+                }
+            }
+            err = guestTable_addManyShared(table, replay->guests, count);
+            break;
+        default:
+            return ERR_INVALID;
+    }
+
+    // Only the changes accepted by the congress are logged, so any other error is not expected, and it does not stop the replay
+    return (err == ERR_MEMORY_ERROR) ? err : OK;
+}
+
+// Make the next size bytes of the log available on the buffer, from position start. Returns false at the end of the file.
+static bool wal_fill(tWal* wal, size_t* start, size_t* filled, size_t size, tError* err) {
+    char* buffer;
+    int count;
+
+    if(*filled - *start >= size) {
+        return true;
+    }
+
+    // The bytes already read are moved to the start of the buffer, which grows for records larger than it
+    memmove(wal->buffer, wal->buffer + *start, *filled - *start);
+    *filled -= *start;
+    *start = 0;
+    if(size > wal->capacity) {
+        buffer = (char*) realloc(wal->buffer, size);
+        if(buffer == NULL) {
+            *err = ERR_MEMORY_ERROR;
+            return false;
+        }
+        wal->buffer = buffer;
+        wal->capacity = size;
+    }
+
+    while(*filled < size) {
+        count = read(wal->fd, wal->buffer + *filled, (wal->capacity - *filled > WAL_BUFFER_SIZE) ? WAL_BUFFER_SIZE : (unsigned int) (wal->capacity - *filled));
+        if(count < 0) {
+            *err = ERR_CANNOT_READ;
+            return false;
+        }
+        if(count == 0) {
+            return false;
+        }
+        *filled += count;
+    }
+
+    return true;
+}
+
+// Make the next size bytes of the log available, as wal_fill. The presentations waiting on the batch point to the buffer, so they are added before the buffer is moved.
+static bool wal_replayFill(tWal* wal, tWalReplay* replay, size_t* start, size_t* filled, size_t size, tError* err) {
+    if(*filled - *start < size && replay->count > 0) {
+        *err = wal_flushReplay(replay);
+        if(*err != OK) {
+            return false;
+        }
+    }
+
+    return wal_fill(wal, start, filled, size, err);
+}
+
+// Apply the records of the log to the replay. The size of the valid part of the log is returned on size, or 0 if it has no header.
+static tError wal_replayRecords(tWal* wal, tWalReplay* replay, long long* size) {
+    uint32_t header[2];
+    uint32_t length, checksum;
+    size_t start, filled;
+    tError err;
+
+    err = OK;
+    start = 0;
+    filled = 0;
+    *size = 0;
+
+    // A log that was cut before its header is written again
+    if(!wal_fill(wal, &start, &filled, WAL_FILE_HEADER_SIZE, &err)) {
+        return err;
+    }
+    memcpy(header, wal->buffer, WAL_FILE_HEADER_SIZE);
+    if(header[0] != WAL_MAGIC || header[1] != WAL_VERSION) {
+        return ERR_INVALID;
+    }
+    start = WAL_FILE_HEADER_SIZE;
+    *size = WAL_FILE_HEADER_SIZE;
+
+    // The replay stops on the first record that is incomplete or does not match its checksum
+    while(wal_replayFill(wal, replay, &start, &filled, sizeof(uint32_t), &err)) {
+        memcpy(&length, wal->buffer + start, sizeof(uint32_t));
+        if(length == 0 || length > WAL_MAX_RECORD_SIZE || !wal_replayFill(wal, replay, &start, &filled, length + WAL_RECORD_OVERHEAD, &err)) {
+            break;
+        }
+        memcpy(&checksum, wal->buffer + start + sizeof(uint32_t) + length, sizeof(uint32_t));
+        if(checksum != wal_checksum(wal->buffer + start + sizeof(uint32_t), length)) {
+            break;
+        }
+        err = wal_apply(replay, wal->buffer + start + sizeof(uint32_t), length);
+        if(err == ERR_INVALID) {
+            err = OK;
+            break;
+        } else if(err != OK) {
+            return err;
+        }
+        wal->replayed++;
+        start += length + WAL_RECORD_OVERHEAD;
+        *size += length + WAL_RECORD_OVERHEAD;
+    }
+
+    return err;
+}
+
+// Apply the records of the log to the congress. The tables of guests created are added to the tables written to the log.
+static tError wal_replay(tWal* wal, tCongress* object, long long* size) {
+    tWalReplay* replay;
+    unsigned int i;
+    tError err;
+
+    replay = (tWalReplay*) malloc(sizeof(tWalReplay));
+    if(replay == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    replay->congress = object;
+    replay->firstTable = object->guestTablesCount;
+    replay->count = 0;
+
+    err = wal_replayRecords(wal, replay, size);
+    if(err == OK) {
+        err = wal_flushReplay(replay);
+    }
+
+    // The new records refer to the tables by their number on the log
+    for(i=replay->firstTable; err == OK && i<object->guestTablesCount; i++) {
+        wal->lastTable++;
+        err = wal_setGuestTable(wal, object->guestTables[i], wal->lastTable);
+    }
+
+    free(replay);
+
+    return err;
+}
+
+// Open a log, creating it if it does not exist. The records already on the log are applied to the congress. The organizations are registered with tables of guests owned by the congress, holding the guests they had when they were logged.
+// A damaged record at the end of the log, left by a crash while writing it, is removed. Returns ERR_CANNOT_READ or ERR_CANNOT_WRITE if the file cannot be used, or ERR_INVALID if it is not a log.
+tError wal_open(tWal* wal, const char* path, unsigned int groupSize, tCongress* object) {
+    uint32_t header[2];
+    long long size;
+    tError err;
+
+    // Verify pre conditions
+    assert(wal != NULL);
+    assert(path != NULL);
+    assert(groupSize > 0);
+    assert(object != NULL);
+
+    wal->used = 0;
+    wal->pending = 0;
+    wal->groupSize = groupSize;
+    wal->replayed = 0;
+    wal->commits = 0;
+    wal->size = 0;
+    wal->failed = false;
+    wal->tables = NULL;
+    wal->tablesCount = 0;
+    wal->tablesCapacity = 0;
+    wal->lastTable = 0;
+    wal->capacity = WAL_BUFFER_SIZE;
+    wal->buffer = (char*) malloc(wal->capacity);
+    if(wal->buffer == NULL) {
+        return ERR_MEMORY_ERROR;
+    }
+    wal->fd = open(path, O_RDWR | O_CREAT | O_BINARY, 0644);
+    if(wal->fd < 0) {
+        free(wal->buffer);
+        return ERR_CANNOT_READ;
+    }
+
+    err = wal_replay(wal, object, &size);
+
+    // The new records are written after the last valid one
+    if(err == OK && wal_truncate(wal->fd, size) != 0) {
+        err = ERR_CANNOT_WRITE;
+    }
+    if(err == OK && size == 0) {
+        header[0] = WAL_MAGIC;
+        header[1] = WAL_VERSION;
+        if(!wal_writeAll(wal->fd, (const char*) header, WAL_FILE_HEADER_SIZE) || wal_sync(wal->fd) != 0) {
+            err = ERR_CANNOT_WRITE;
+        }
+        size = WAL_FILE_HEADER_SIZE;
+    }
+    wal->size = size;
+    if(err != OK) {
+        close(wal->fd);
+        free(wal->buffer);
+        free(wal->tables);
+    }
+
+    return err;
+}
+
+// Commit the records waiting on the log and close it
+tError wal_close(tWal* wal) {
+    tError err;
+
+    // Verify pre conditions
+    assert(wal != NULL);
+
+    err = wal_commit(wal);
+    if(close(wal->fd) != 0 && err == OK) {
+        err = ERR_CANNOT_WRITE;
+    }
+    free(wal->buffer);
+    wal->buffer = NULL;
+    free(wal->tables);
+    wal->tables = NULL;
+    wal->tablesCount = 0;
+    wal->tablesCapacity = 0;
+
+    return err;
+}
+
+// Register an organization on the congress, and add the change to the log
+tError congress_registerOrganizationLogged(tCongress* object, tWal* wal, tOrganization* organization) {
+    const char* strings[1];
+    tWalMark mark;
+    uint32_t number;
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(wal != NULL);
+    assert(organization != NULL);
+
+    // Only the changes accepted by the congress are logged, and the records are added before the change is applied, so the congress never has a change that is not on the log
+    if(congress_findOrganization(object, organization->name) != NULL) {
+        return ERR_DUPLICATED;
+    }
+    wal_mark(wal, &mark);
+    err = wal_addGuestTable(wal, organization->guests, &number);
+    if(err == OK) {
+        strings[0] = organization->name;
+        err = wal_add(wal, WAL_RECORD_REGISTER_ORGANIZATION, &number, sizeof(uint32_t), strings, 1);
+    }
+    if(err == OK) {
+        err = congress_registerOrganization(object, organization);
+    }
+    if(err != OK) {
+        wal_undo(wal, &mark);
+        return err;
+    }
+
+    return wal_endChange(wal);
+}
+
+// Remove an organization from the congress, and add the change to the log
+tError congress_removeOrganizationLogged(tCongress* object, tWal* wal, tOrganization* organization) {
+    const char* strings[1];
+    tWalMark mark;
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(wal != NULL);
+    assert(organization != NULL);
+
+    // The change is logged before it is applied, as the organization can be the one stored on the congress, and its name is released by the change
+    if(congress_findOrganization(object, organization->name) == NULL) {
+        return ERR_NOT_FOUND;
+    }
+    wal_mark(wal, &mark);
+    strings[0] = organization->name;
+    err = wal_add(wal, WAL_RECORD_REMOVE_ORGANIZATION, NULL, 0, strings, 1);
+    if(err == OK) {
+        err = congress_removeOrganization(object, organization);
+    }
+    if(err != OK) {
+        wal_undo(wal, &mark);
+        return err;
+    }
+
+    return wal_endChange(wal);
+}
+
+// Add a presentation to the congress, and add the change to the log
+tError congress_addPresentationLogged(tCongress* object, tWal* wal, const char* organization_name, double score, const char* presentationTitle, const char* presentationTopic) {
+    const char* strings[3];
+    tWalMark mark;
+    tError err;
+
+    // Verify pre conditions
+    assert(object != NULL);
+    assert(wal != NULL);
+    assert(organization_name != NULL);
+    assert(presentationTitle != NULL);
+    assert(presentationTopic != NULL);
+
+    if(congress_findOrganization(object, organization_name) == NULL) {
+        return ERR_INVALID_ORGANIZATION;
+    }
+    wal_mark(wal, &mark);
+    strings[0] = organization_name;
+    strings[1] = presentationTitle;
+    strings[2] = presentationTopic;
+    err = wal_add(wal, WAL_RECORD_ADD_PRESENTATION, &score, sizeof(double), strings, 3);
+    if(err == OK) {
+        err = congress_addPresentation(object, organization_name, score, presentationTitle, presentationTopic);
+    }
+    if(err != OK) {
+        wal_undo(wal, &mark);
+        return err;
+    }
+
+    return wal_endChange(wal);
+}